@@ -0,0 +1,70 @@
+/**
+ * @file analysis.c
+ * @brief Implementation of the analysis cache
+ */
+
+#include "analysis.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/** Cached results, shared by every game */
+static analysis_entry_t table[ANALYSIS_BUCKETS][ANALYSIS_WAYS];
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Get the bucket of a position
+ * @param key Position key
+ * @return analysis_entry_t* First entry of the bucket
+ */
+static inline analysis_entry_t* bucket_of(zobrist_key_t key) {
+    return table[key & (ANALYSIS_BUCKETS - 1)];
+}
+
+// ==========================
+//     Public Functions
+// ==========================
+
+void analysis_clear(void) {
+    memset(table, 0, sizeof(table));
+}
+
+void analysis_store(zobrist_key_t key, move_t best_move, int16_t score, uint8_t depth) {
+    if (depth == 0) {
+        return;
+    }
+
+    analysis_entry_t* bucket = bucket_of(key);
+    analysis_entry_t* slot = &bucket[0];
+
+    for (uint8_t i = 0; i < ANALYSIS_WAYS; ++i) {
+        if (bucket[i].depth && bucket[i].key == key) {
+            if (depth < bucket[i].depth) {
+                return;
+            }
+            slot = &bucket[i];
+            break;
+        }
+        if (bucket[i].depth < slot->depth) {
+            slot = &bucket[i];
+        }
+    }
+
+    slot->key = key;
+    slot->best_move = best_move;
+    slot->score = score;
+    slot->depth = depth;
+}
+
+const analysis_entry_t* analysis_probe(zobrist_key_t key) {
+    analysis_entry_t* bucket = bucket_of(key);
+    for (uint8_t i = 0; i < ANALYSIS_WAYS; ++i) {
+        if (bucket[i].depth && bucket[i].key == key) {
+            return &bucket[i];
+        }
+    }
+    return NULL;
+}
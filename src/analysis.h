@@ -0,0 +1,68 @@
+/**
+ * @file analysis.h
+ * @brief Per-position cache of analysis results
+ *
+ * Remembers the deepest result found for each position the user has looked
+ * at, so stepping back and forth through a game in the analysis view can
+ * show earlier results at once and resume searching from the depth already
+ * reached instead of starting over.
+ *
+ * The cache is a fixed table of two-entry buckets indexed by the position's
+ * Zobrist key. A new result replaces an existing entry for the same position
+ * only if it is at least as deep; otherwise it evicts the shallower of the
+ * two entries in its bucket.
+ */
+
+#pragma once
+
+#include "board.h"
+#include "move.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of buckets (power of two) */
+#define ANALYSIS_BUCKETS 128
+
+/** Entries per bucket */
+#define ANALYSIS_WAYS 2
+
+/**
+ * @brief Analysis result of one position
+ */
+typedef struct {
+    zobrist_key_t key; /**< Position key */
+    move_t best_move;  /**< Best move found */
+    int16_t score;     /**< Score in centipawns from the side to move's view */
+    uint8_t depth;     /**< Depth reached, or 0 for an empty entry */
+} analysis_entry_t;
+
+/**
+ * @brief Forget every stored result
+ */
+void analysis_clear(void);
+
+/**
+ * @brief Record a result for a position
+ * @param key       Position key (board->key)
+ * @param best_move Best move found
+ * @param score     Score from the side to move's view
+ * @param depth     Depth reached (at least 1)
+ *
+ * Ignored if a deeper result for the same position is already stored.
+ */
+void analysis_store(zobrist_key_t key, move_t best_move, int16_t score, uint8_t depth);
+
+/**
+ * @brief Look up the stored result for a position
+ * @param key Position key (board->key)
+ * @return Pointer to the entry, or NULL if the position has no result
+ *
+ * The entry stays valid until the next analysis_store() or analysis_clear().
+ */
+const analysis_entry_t* analysis_probe(zobrist_key_t key);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,426 @@
+/**
+ * @file attack.c
+ * @brief Implementation of square attack detection
+ */
+
+#include "attack.h"
+
+#include "profile.h"
+
+// ==========================
+//      Target Tables
+// ==========================
+
+/*
+ * Generated from the knight deltas {33, 31, 18, 14, -14, -18, -31, -33} and
+ * the king deltas in DIRECTION_OFFSETS order, keeping only on-board targets.
+ * Off-board 0x88 indices are left zeroed (count 0).
+ */
+
+const target_list_t KNIGHT_TARGETS[BOARD_SIZE(BOARD_LOGICAL)] = {
+    [0x00] = {2, {0x21, 0x12}},                                      // a1
+    [0x01] = {3, {0x22, 0x20, 0x13}},                                // b1
+    [0x02] = {4, {0x23, 0x21, 0x14, 0x10}},                          // c1
+    [0x03] = {4, {0x24, 0x22, 0x15, 0x11}},                          // d1
+    [0x04] = {4, {0x25, 0x23, 0x16, 0x12}},                          // e1
+    [0x05] = {4, {0x26, 0x24, 0x17, 0x13}},                          // f1
+    [0x06] = {3, {0x27, 0x25, 0x14}},                                // g1
+    [0x07] = {2, {0x26, 0x15}},                                      // h1
+    [0x10] = {3, {0x31, 0x22, 0x02}},                                // a2
+    [0x11] = {4, {0x32, 0x30, 0x23, 0x03}},                          // b2
+    [0x12] = {6, {0x33, 0x31, 0x24, 0x20, 0x04, 0x00}},              // c2
+    [0x13] = {6, {0x34, 0x32, 0x25, 0x21, 0x05, 0x01}},              // d2
+    [0x14] = {6, {0x35, 0x33, 0x26, 0x22, 0x06, 0x02}},              // e2
+    [0x15] = {6, {0x36, 0x34, 0x27, 0x23, 0x07, 0x03}},              // f2
+    [0x16] = {4, {0x37, 0x35, 0x24, 0x04}},                          // g2
+    [0x17] = {3, {0x36, 0x25, 0x05}},                                // h2
+    [0x20] = {4, {0x41, 0x32, 0x12, 0x01}},                          // a3
+    [0x21] = {6, {0x42, 0x40, 0x33, 0x13, 0x02, 0x00}},              // b3
+    [0x22] = {8, {0x43, 0x41, 0x34, 0x30, 0x14, 0x10, 0x03, 0x01}},  // c3
+    [0x23] = {8, {0x44, 0x42, 0x35, 0x31, 0x15, 0x11, 0x04, 0x02}},  // d3
+    [0x24] = {8, {0x45, 0x43, 0x36, 0x32, 0x16, 0x12, 0x05, 0x03}},  // e3
+    [0x25] = {8, {0x46, 0x44, 0x37, 0x33, 0x17, 0x13, 0x06, 0x04}},  // f3
+    [0x26] = {6, {0x47, 0x45, 0x34, 0x14, 0x07, 0x05}},              // g3
+    [0x27] = {4, {0x46, 0x35, 0x15, 0x06}},                          // h3
+    [0x30] = {4, {0x51, 0x42, 0x22, 0x11}},                          // a4
+    [0x31] = {6, {0x52, 0x50, 0x43, 0x23, 0x12, 0x10}},              // b4
+    [0x32] = {8, {0x53, 0x51, 0x44, 0x40, 0x24, 0x20, 0x13, 0x11}},  // c4
+    [0x33] = {8, {0x54, 0x52, 0x45, 0x41, 0x25, 0x21, 0x14, 0x12}},  // d4
+    [0x34] = {8, {0x55, 0x53, 0x46, 0x42, 0x26, 0x22, 0x15, 0x13}},  // e4
+    [0x35] = {8, {0x56, 0x54, 0x47, 0x43, 0x27, 0x23, 0x16, 0x14}},  // f4
+    [0x36] = {6, {0x57, 0x55, 0x44, 0x24, 0x17, 0x15}},              // g4
+    [0x37] = {4, {0x56, 0x45, 0x25, 0x16}},                          // h4
+    [0x40] = {4, {0x61, 0x52, 0x32, 0x21}},                          // a5
+    [0x41] = {6, {0x62, 0x60, 0x53, 0x33, 0x22, 0x20}},              // b5
+    [0x42] = {8, {0x63, 0x61, 0x54, 0x50, 0x34, 0x30, 0x23, 0x21}},  // c5
+    [0x43] = {8, {0x64, 0x62, 0x55, 0x51, 0x35, 0x31, 0x24, 0x22}},  // d5
+    [0x44] = {8, {0x65, 0x63, 0x56, 0x52, 0x36, 0x32, 0x25, 0x23}},  // e5
+    [0x45] = {8, {0x66, 0x64, 0x57, 0x53, 0x37, 0x33, 0x26, 0x24}},  // f5
+    [0x46] = {6, {0x67, 0x65, 0x54, 0x34, 0x27, 0x25}},              // g5
+    [0x47] = {4, {0x66, 0x55, 0x35, 0x26}},                          // h5
+    [0x50] = {4, {0x71, 0x62, 0x42, 0x31}},                          // a6
+    [0x51] = {6, {0x72, 0x70, 0x63, 0x43, 0x32, 0x30}},              // b6
+    [0x52] = {8, {0x73, 0x71, 0x64, 0x60, 0x44, 0x40, 0x33, 0x31}},  // c6
+    [0x53] = {8, {0x74, 0x72, 0x65, 0x61, 0x45, 0x41, 0x34, 0x32}},  // d6
+    [0x54] = {8, {0x75, 0x73, 0x66, 0x62, 0x46, 0x42, 0x35, 0x33}},  // e6
+    [0x55] = {8, {0x76, 0x74, 0x67, 0x63, 0x47, 0x43, 0x36, 0x34}},  // f6
+    [0x56] = {6, {0x77, 0x75, 0x64, 0x44, 0x37, 0x35}},              // g6
+    [0x57] = {4, {0x76, 0x65, 0x45, 0x36}},                          // h6
+    [0x60] = {3, {0x72, 0x52, 0x41}},                                // a7
+    [0x61] = {4, {0x73, 0x53, 0x42, 0x40}},                          // b7
+    [0x62] = {6, {0x74, 0x70, 0x54, 0x50, 0x43, 0x41}},              // c7
+    [0x63] = {6, {0x75, 0x71, 0x55, 0x51, 0x44, 0x42}},              // d7
+    [0x64] = {6, {0x76, 0x72, 0x56, 0x52, 0x45, 0x43}},              // e7
+    [0x65] = {6, {0x77, 0x73, 0x57, 0x53, 0x46, 0x44}},              // f7
+    [0x66] = {4, {0x74, 0x54, 0x47, 0x45}},                          // g7
+    [0x67] = {3, {0x75, 0x55, 0x46}},                                // h7
+    [0x70] = {2, {0x62, 0x51}},                                      // a8
+    [0x71] = {3, {0x63, 0x52, 0x50}},                                // b8
+    [0x72] = {4, {0x64, 0x60, 0x53, 0x51}},                          // c8
+    [0x73] = {4, {0x65, 0x61, 0x54, 0x52}},                          // d8
+    [0x74] = {4, {0x66, 0x62, 0x55, 0x53}},                          // e8
+    [0x75] = {4, {0x67, 0x63, 0x56, 0x54}},                          // f8
+    [0x76] = {3, {0x64, 0x57, 0x55}},                                // g8
+    [0x77] = {2, {0x65, 0x56}},                                      // h8
+};
+
+const target_list_t KING_TARGETS[BOARD_SIZE(BOARD_LOGICAL)] = {
+    [0x00] = {3, {0x10, 0x11, 0x01}},                                // a1
+    [0x01] = {5, {0x11, 0x12, 0x02, 0x00, 0x10}},                    // b1
+    [0x02] = {5, {0x12, 0x13, 0x03, 0x01, 0x11}},                    // c1
+    [0x03] = {5, {0x13, 0x14, 0x04, 0x02, 0x12}},                    // d1
+    [0x04] = {5, {0x14, 0x15, 0x05, 0x03, 0x13}},                    // e1
+    [0x05] = {5, {0x15, 0x16, 0x06, 0x04, 0x14}},                    // f1
+    [0x06] = {5, {0x16, 0x17, 0x07, 0x05, 0x15}},                    // g1
+    [0x07] = {3, {0x17, 0x06, 0x16}},                                // h1
+    [0x10] = {5, {0x20, 0x21, 0x11, 0x01, 0x00}},                    // a2
+    [0x11] = {8, {0x21, 0x22, 0x12, 0x02, 0x01, 0x00, 0x10, 0x20}},  // b2
+    [0x12] = {8, {0x22, 0x23, 0x13, 0x03, 0x02, 0x01, 0x11, 0x21}},  // c2
+    [0x13] = {8, {0x23, 0x24, 0x14, 0x04, 0x03, 0x02, 0x12, 0x22}},  // d2
+    [0x14] = {8, {0x24, 0x25, 0x15, 0x05, 0x04, 0x03, 0x13, 0x23}},  // e2
+    [0x15] = {8, {0x25, 0x26, 0x16, 0x06, 0x05, 0x04, 0x14, 0x24}},  // f2
+    [0x16] = {8, {0x26, 0x27, 0x17, 0x07, 0x06, 0x05, 0x15, 0x25}},  // g2
+    [0x17] = {5, {0x27, 0x07, 0x06, 0x16, 0x26}},                    // h2
+    [0x20] = {5, {0x30, 0x31, 0x21, 0x11, 0x10}},                    // a3
+    [0x21] = {8, {0x31, 0x32, 0x22, 0x12, 0x11, 0x10, 0x20, 0x30}},  // b3
+    [0x22] = {8, {0x32, 0x33, 0x23, 0x13, 0x12, 0x11, 0x21, 0x31}},  // c3
+    [0x23] = {8, {0x33, 0x34, 0x24, 0x14, 0x13, 0x12, 0x22, 0x32}},  // d3
+    [0x24] = {8, {0x34, 0x35, 0x25, 0x15, 0x14, 0x13, 0x23, 0x33}},  // e3
+    [0x25] = {8, {0x35, 0x36, 0x26, 0x16, 0x15, 0x14, 0x24, 0x34}},  // f3
+    [0x26] = {8, {0x36, 0x37, 0x27, 0x17, 0x16, 0x15, 0x25, 0x35}},  // g3
+    [0x27] = {5, {0x37, 0x17, 0x16, 0x26, 0x36}},                    // h3
+    [0x30] = {5, {0x40, 0x41, 0x31, 0x21, 0x20}},                    // a4
+    [0x31] = {8, {0x41, 0x42, 0x32, 0x22, 0x21, 0x20, 0x30, 0x40}},  // b4
+    [0x32] = {8, {0x42, 0x43, 0x33, 0x23, 0x22, 0x21, 0x31, 0x41}},  // c4
+    [0x33] = {8, {0x43, 0x44, 0x34, 0x24, 0x23, 0x22, 0x32, 0x42}},  // d4
+    [0x34] = {8, {0x44, 0x45, 0x35, 0x25, 0x24, 0x23, 0x33, 0x43}},  // e4
+    [0x35] = {8, {0x45, 0x46, 0x36, 0x26, 0x25, 0x24, 0x34, 0x44}},  // f4
+    [0x36] = {8, {0x46, 0x47, 0x37, 0x27, 0x26, 0x25, 0x35, 0x45}},  // g4
+    [0x37] = {5, {0x47, 0x27, 0x26, 0x36, 0x46}},                    // h4
+    [0x40] = {5, {0x50, 0x51, 0x41, 0x31, 0x30}},                    // a5
+    [0x41] = {8, {0x51, 0x52, 0x42, 0x32, 0x31, 0x30, 0x40, 0x50}},  // b5
+    [0x42] = {8, {0x52, 0x53, 0x43, 0x33, 0x32, 0x31, 0x41, 0x51}},  // c5
+    [0x43] = {8, {0x53, 0x54, 0x44, 0x34, 0x33, 0x32, 0x42, 0x52}},  // d5
+    [0x44] = {8, {0x54, 0x55, 0x45, 0x35, 0x34, 0x33, 0x43, 0x53}},  // e5
+    [0x45] = {8, {0x55, 0x56, 0x46, 0x36, 0x35, 0x34, 0x44, 0x54}},  // f5
+    [0x46] = {8, {0x56, 0x57, 0x47, 0x37, 0x36, 0x35, 0x45, 0x55}},  // g5
+    [0x47] = {5, {0x57, 0x37, 0x36, 0x46, 0x56}},                    // h5
+    [0x50] = {5, {0x60, 0x61, 0x51, 0x41, 0x40}},                    // a6
+    [0x51] = {8, {0x61, 0x62, 0x52, 0x42, 0x41, 0x40, 0x50, 0x60}},  // b6
+    [0x52] = {8, {0x62, 0x63, 0x53, 0x43, 0x42, 0x41, 0x51, 0x61}},  // c6
+    [0x53] = {8, {0x63, 0x64, 0x54, 0x44, 0x43, 0x42, 0x52, 0x62}},  // d6
+    [0x54] = {8, {0x64, 0x65, 0x55, 0x45, 0x44, 0x43, 0x53, 0x63}},  // e6
+    [0x55] = {8, {0x65, 0x66, 0x56, 0x46, 0x45, 0x44, 0x54, 0x64}},  // f6
+    [0x56] = {8, {0x66, 0x67, 0x57, 0x47, 0x46, 0x45, 0x55, 0x65}},  // g6
+    [0x57] = {5, {0x67, 0x47, 0x46, 0x56, 0x66}},                    // h6
+    [0x60] = {5, {0x70, 0x71, 0x61, 0x51, 0x50}},                    // a7
+    [0x61] = {8, {0x71, 0x72, 0x62, 0x52, 0x51, 0x50, 0x60, 0x70}},  // b7
+    [0x62] = {8, {0x72, 0x73, 0x63, 0x53, 0x52, 0x51, 0x61, 0x71}},  // c7
+    [0x63] = {8, {0x73, 0x74, 0x64, 0x54, 0x53, 0x52, 0x62, 0x72}},  // d7
+    [0x64] = {8, {0x74, 0x75, 0x65, 0x55, 0x54, 0x53, 0x63, 0x73}},  // e7
+    [0x65] = {8, {0x75, 0x76, 0x66, 0x56, 0x55, 0x54, 0x64, 0x74}},  // f7
+    [0x66] = {8, {0x76, 0x77, 0x67, 0x57, 0x56, 0x55, 0x65, 0x75}},  // g7
+    [0x67] = {5, {0x77, 0x57, 0x56, 0x66, 0x76}},                    // h7
+    [0x70] = {3, {0x71, 0x61, 0x60}},                                // a8
+    [0x71] = {5, {0x72, 0x62, 0x61, 0x60, 0x70}},                    // b8
+    [0x72] = {5, {0x73, 0x63, 0x62, 0x61, 0x71}},                    // c8
+    [0x73] = {5, {0x74, 0x64, 0x63, 0x62, 0x72}},                    // d8
+    [0x74] = {5, {0x75, 0x65, 0x64, 0x63, 0x73}},                    // e8
+    [0x75] = {5, {0x76, 0x66, 0x65, 0x64, 0x74}},                    // f8
+    [0x76] = {5, {0x77, 0x67, 0x66, 0x65, 0x75}},                    // g8
+    [0x77] = {3, {0x67, 0x66, 0x76}},                                // h8
+};
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Get the piece that could attack from a square after a hypothetical move
+ * @param board    Board to query
+ * @param square   Valid square to inspect
+ * @param vacated  Square treated as empty
+ * @param captured Square treated as empty
+ * @param occupied Square whose piece is treated as captured
+ * @return piece_t Piece on the square, or PIECE_NONE if it cannot attack
+ */
+static inline piece_t attacker_at(const board_t* board, square_t square, square_t vacated,
+                                  square_t captured, square_t occupied) {
+    if (square == vacated || square == captured || square == occupied) {
+        return PIECE_NONE;
+    }
+    return board->squares[square];
+}
+
+/**
+ * @brief Find the first piece along a ray using the board's ray table
+ * @param board    Board to query
+ * @param square   Starting square (excluded)
+ * @param dir      Direction to look in
+ * @param vacated  Square treated as empty
+ * @param captured Square treated as empty
+ * @return piece_t First piece found, or PIECE_NONE if the ray is clear
+ *
+ * Jumps from blocker to blocker, so only vacated squares cost an extra step.
+ */
+static piece_t first_piece_jumping(const board_t* board, square_t square, uint8_t dir,
+                                   square_t vacated, square_t captured) {
+    square_t from = board_ray_end(board, square, dir);
+    if (from == square) {
+        return PIECE_NONE;
+    }
+
+    while (from == vacated || from == captured) {
+        square_t next = board_ray_end(board, from, dir);
+        if (next == from) {
+            return PIECE_NONE;
+        }
+        from = next;
+    }
+
+    return board->squares[from];
+}
+
+/**
+ * @brief Find the first piece along a ray one square at a time
+ * @param board    Board to query
+ * @param square   Starting square (excluded)
+ * @param dir      Direction to look in
+ * @param vacated  Square treated as empty
+ * @param captured Square treated as empty
+ * @param occupied Square treated as a non-attacking blocker
+ * @return piece_t First piece found, or PIECE_NONE if the ray is clear or blocked
+ *
+ * Needed when a hypothetical blocker may sit in front of the real ray end.
+ */
+static piece_t first_piece_stepping(const board_t* board, square_t square, uint8_t dir,
+                                    square_t vacated, square_t captured, square_t occupied) {
+    int8_t offset = DIRECTION_OFFSETS[dir];
+
+    for (square_t from = square + offset; is_valid_square(from); from += offset) {
+        piece_t piece = attacker_at(board, from, vacated, captured, occupied);
+        if (from == occupied || piece != PIECE_NONE) {
+            return piece;
+        }
+    }
+
+    return PIECE_NONE;
+}
+
+/**
+ * @brief Attack test specialized for one attacking side
+ * @param board    Board to query
+ * @param square   Target square in 0x88 format
+ * @param by_side  Attacking side; a compile-time constant in every caller
+ * @param vacated  Square treated as empty, or NO_SQUARE
+ * @param captured Extra square treated as empty, or NO_SQUARE
+ * @param occupied Square treated as holding a non-attacking blocker, or NO_SQUARE
+ * @return true if any remaining piece of by_side attacks the square
+ */
+static ALWAYS_INLINE bool attacked_by(const board_t* board, square_t square, const side_t by_side,
+                                      square_t vacated, square_t captured, square_t occupied) {
+    const piece_color_t color = SIDE_TO_COLOR(by_side);
+
+    /* Pawns attack diagonally forward, so look diagonally backward */
+    square_t pawn_rank = square + (by_side == SIDE_WHITE ? -16 : 16);
+    piece_t pawn = MAKE_PIECE(color, PIECE_PAWN);
+    if (is_valid_square(pawn_rank - 1) &&
+        attacker_at(board, pawn_rank - 1, vacated, captured, occupied) == pawn) {
+        return true;
+    }
+    if (is_valid_square(pawn_rank + 1) &&
+        attacker_at(board, pawn_rank + 1, vacated, captured, occupied) == pawn) {
+        return true;
+    }
+
+    /* Leaper moves are symmetric, so the target lists double as source lists */
+    const target_list_t* list = &KNIGHT_TARGETS[square];
+    piece_t knight = MAKE_PIECE(color, PIECE_KNIGHT);
+    for (uint8_t i = 0; i < list->count; ++i) {
+        if (attacker_at(board, list->targets[i], vacated, captured, occupied) == knight) {
+            return true;
+        }
+    }
+
+    list = &KING_TARGETS[square];
+    piece_t king = MAKE_PIECE(color, PIECE_KING);
+    for (uint8_t i = 0; i < list->count; ++i) {
+        if (attacker_at(board, list->targets[i], vacated, captured, occupied) == king) {
+            return true;
+        }
+    }
+
+    /* Sliders: the first piece on each ray decides */
+    piece_t queen = MAKE_PIECE(color, PIECE_QUEEN);
+    bool jump = (occupied == NO_SQUARE || occupied == square);
+    for (uint8_t dir = 0; dir < DIR_COUNT; ++dir) {
+        piece_t slider = MAKE_PIECE(color, IS_DIAGONAL_DIR(dir) ? PIECE_BISHOP : PIECE_ROOK);
+        piece_t piece = jump ? first_piece_jumping(board, square, dir, vacated, captured)
+                             : first_piece_stepping(board, square, dir, vacated, captured,
+                                                    occupied);
+        if (piece == slider || piece == queen) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** @copydoc attacked_by */
+static bool attacked_by_white(const board_t* board, square_t square, square_t vacated,
+                              square_t captured, square_t occupied) {
+    return attacked_by(board, square, SIDE_WHITE, vacated, captured, occupied);
+}
+
+/** @copydoc attacked_by */
+static bool attacked_by_black(const board_t* board, square_t square, square_t vacated,
+                              square_t captured, square_t occupied) {
+    return attacked_by(board, square, SIDE_BLACK, vacated, captured, occupied);
+}
+
+// ==========================
+//     Public Functions
+// ==========================
+
+bool is_square_attacked(const board_t* board, square_t square, side_t by_side) {
+    return is_square_attacked_after(board, square, by_side, NO_SQUARE, NO_SQUARE, NO_SQUARE);
+}
+
+bool is_square_attacked_after(const board_t* board, square_t square, side_t by_side,
+                              square_t vacated, square_t captured, square_t occupied) {
+    PROFILE_ZONE("attack: square");
+
+    /* Dispatch once; each variant has its pawn direction and piece codes baked in */
+    return by_side == SIDE_WHITE ? attacked_by_white(board, square, vacated, captured, occupied)
+                                 : attacked_by_black(board, square, vacated, captured, occupied);
+}
+
+/**
+ * @brief Record a checking piece and, for a single check, its evasion squares
+ * @param info    Check info being filled
+ * @param king    Square of the checked king
+ * @param checker Square of the checking piece
+ * @param offset  Step from king toward a sliding checker, or 0 for a contact check
+ *
+ * Every checker is counted, but only the first two squares are stored; a
+ * count above two marks a position that cannot arise in a game.
+ */
+static void add_checker(check_info_t* info, square_t king, square_t checker, int8_t offset) {
+    uint8_t index = info->num_checkers++;
+    if (index >= 2) {
+        return;
+    }
+    info->checkers[index] = checker;
+
+    /* In double check only the king can move, so no square helps */
+    if (info->num_checkers > 1) {
+        info->num_evasions = 0;
+        return;
+    }
+
+    if (offset) {
+        for (square_t square = king + offset; square != checker; square += offset) {
+            info->evasions[info->num_evasions++] = square;
+        }
+    }
+    info->evasions[info->num_evasions++] = checker;
+}
+
+void compute_check_info(const board_t* board, side_t side, check_info_t* info) {
+    PROFILE_ZONE("attack: check info");
+
+    info->revision = board->revision;
+    info->side = side;
+    info->num_checkers = 0;
+    info->num_evasions = 0;
+    info->num_pinned = 0;
+
+    /* Also tells the compiler that side indexes king_square[] in bounds */
+    if (side >= SIDE_COUNT) {
+        return;
+    }
+
+    piece_color_t color = SIDE_TO_COLOR(side);
+    piece_color_t enemy = SIDE_TO_COLOR(OPPOSITE_SIDE(side));
+    square_t king = board->king_square[side];
+    if (board->squares[king] != MAKE_PIECE(color, PIECE_KING)) {
+        return;
+    }
+
+    /* Enemy pawns attack the king from one rank ahead of it */
+    square_t pawn_rank = king + (side == SIDE_WHITE ? 16 : -16);
+    piece_t pawn = MAKE_PIECE(enemy, PIECE_PAWN);
+    if (is_valid_square(pawn_rank - 1) && board->squares[(square_t)(pawn_rank - 1)] == pawn) {
+        add_checker(info, king, pawn_rank - 1, 0);
+    }
+    if (is_valid_square(pawn_rank + 1) && board->squares[(square_t)(pawn_rank + 1)] == pawn) {
+        add_checker(info, king, pawn_rank + 1, 0);
+    }
+
+    const target_list_t* knights = &KNIGHT_TARGETS[king];
+    piece_t knight = MAKE_PIECE(enemy, PIECE_KNIGHT);
+    for (uint8_t i = 0; i < knights->count; ++i) {
+        if (board->squares[knights->targets[i]] == knight) {
+            add_checker(info, king, knights->targets[i], 0);
+        }
+    }
+
+    /* Look down each ray: an enemy slider first is a checker, behind a friend it pins */
+    piece_t queen = MAKE_PIECE(enemy, PIECE_QUEEN);
+    for (uint8_t dir = 0; dir < DIR_COUNT; ++dir) {
+        piece_t slider = MAKE_PIECE(enemy, IS_DIAGONAL_DIR(dir) ? PIECE_BISHOP : PIECE_ROOK);
+
+        square_t first = board_ray_end(board, king, dir);
+        piece_t piece = board->squares[first];
+        if (first == king || piece == PIECE_NONE) {
+            continue;
+        }
+
+        if (!IS_PIECE_COLOR(piece, color)) {
+            if (piece == slider || piece == queen) {
+                add_checker(info, king, first, DIRECTION_OFFSETS[dir]);
+            }
+            continue;
+        }
+
+        square_t second = board_ray_end(board, first, dir);
+        piece = board->squares[second];
+        if (second != first && (piece == slider || piece == queen)) {
+            info->pinned[info->num_pinned++] = first;
+        }
+    }
+}
+
+void board_update_check_info(board_t* board) {
+    compute_check_info(board, board->side_to_move, &board->check_info);
+}
+
+const check_info_t* board_check_info(const board_t* board, check_info_t* scratch) {
+    const check_info_t* info = &board->check_info;
+    if (info->revision == board->revision && info->side == board->side_to_move) {
+        return info;
+    }
+
+    compute_check_info(board, board->side_to_move, scratch);
+    return scratch;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file attack.h
+ * @brief Square attack detection on the 0x88 board
+ *
+ * Answers "is this square attacked by that side?" by looking outward from the
+ * target square: pawn and knight sources are probed directly, and sliding
+ * pieces are found by walking each ray to its first occupied square.
+ *
+ * The `_after` variant evaluates the question as if a move had already been
+ * played, which lets legality checks run against a const board without
+ * making and unmaking the move.
+ *
+ * compute_check_info() gathers checkers and absolutely pinned pieces in one
+ * pass outward from the king, so legality filters only need the full attack
+ * test for king moves, pinned pieces and en passant. The result for the side
+ * to move is cached in board_t::check_info when a position is set up.
+ */
+
+#pragma once
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief On-board destinations of a leaper from one square
+ */
+typedef struct {
+    uint8_t count;       /**< Number of valid targets (2-8) */
+    square_t targets[8]; /**< Target squares in 0x88 format */
+} target_list_t;
+
+/**
+ * @brief Precomputed leaper targets, indexed by 0x88 square
+ *
+ * Only real targets are listed, so loops skip the INVALID_SQUARE() test and
+ * corner squares cost 2-3 iterations instead of 8. Entries for off-board
+ * indices have a count of 0.
+ * @{
+ */
+extern const target_list_t KNIGHT_TARGETS[BOARD_SIZE(BOARD_LOGICAL)];
+extern const target_list_t KING_TARGETS[BOARD_SIZE(BOARD_LOGICAL)];
+/** @} */
+
+/**
+ * @brief Check if a square is attacked by the given side
+ * @param board  Board to query
+ * @param square Target square in 0x88 format
+ * @param by_side Side whose pieces are considered attackers
+ * @return true if any piece of by_side attacks the square
+ */
+bool is_square_attacked(const board_t* board, square_t square, side_t by_side);
+
+/**
+ * @brief Check if a square would be attacked after a hypothetical move
+ * @param board    Board to query
+ * @param square   Target square in 0x88 format
+ * @param by_side  Side whose pieces are considered attackers
+ * @param vacated  Square treated as empty (move origin), or NO_SQUARE
+ * @param captured Extra square treated as empty (en passant victim), or NO_SQUARE
+ * @param occupied Square treated as holding a non-attacking blocker (move
+ *                 destination), or NO_SQUARE
+ * @return true if any remaining piece of by_side attacks the square
+ *
+ * Any piece standing on `occupied` is considered captured, so it neither
+ * attacks nor is looked through.
+ */
+bool is_square_attacked_after(const board_t* board, square_t square, side_t by_side,
+                              square_t vacated, square_t captured, square_t occupied);
+
+/**
+ * @brief Find the pieces checking a king and the pieces pinned to it
+ * @param board Board to query
+ * @param side  Side whose king is examined
+ * @param info  Receives the check and pin state
+ *
+ * Leaves every list empty if side is out of range or has no king on the
+ * board.
+ */
+void compute_check_info(const board_t* board, side_t side, check_info_t* info);
+
+/**
+ * @brief Refresh the cached check info of the side to move
+ * @param board Board to update
+ *
+ * Called whenever a new position is reached so later queries can read
+ * board->check_info instead of scanning again.
+ */
+void board_update_check_info(board_t* board);
+
+/**
+ * @brief Get the check info of the side to move
+ * @param board   Board to query
+ * @param scratch Storage used if the cached info is stale
+ * @return Pointer to the cached info, or to scratch after recomputing it
+ *
+ * The cache is stale after edits made directly through board_set_piece()
+ * or by changing side_to_move without calling board_update_check_info().
+ */
+const check_info_t* board_check_info(const board_t* board, check_info_t* scratch);
+
+/**
+ * @brief Check if a square holds a piece pinned to its king
+ * @param info   Check info of the piece's side
+ * @param square Square to look up
+ * @return true if the square is in the pinned list
+ */
+static inline bool check_info_is_pinned(const check_info_t* info, square_t square) {
+    for (uint8_t i = 0; i < info->num_pinned; ++i) {
+        if (info->pinned[i] == square) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Check if landing on a square resolves a single check
+ * @param info   Check info of the side in check
+ * @param square Destination square of a non-king move
+ * @return true if the square captures the checker or interposes
+ */
+static inline bool check_info_is_evasion(const check_info_t* info, square_t square) {
+    for (uint8_t i = 0; i < info->num_evasions; ++i) {
+        if (info->evasions[i] == square) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef __cplusplus
+}
+#endif
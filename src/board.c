@@ -1,11 +1,112 @@
 #include "board.h"
 
 #include "fen.h"
+#include "zobrist.h"
 
 #include <ctype.h>
 #include <debug.h>
 #include <string.h>
 
+const int8_t DIRECTION_OFFSETS[DIR_COUNT] = {16, 17, 1, -15, -16, -17, -1, 15};
+
+/** Source of board_t::revision stamps, shared by every board */
+static uint24_t revision_counter;
+
+/*
+ * Ray ends of an empty board: the last on-board square in each direction
+ * (DIRECTION_OFFSETS order), or the square itself on that edge. Generated;
+ * indexed by SQUARE_TO_INDEX() like board_t::ray_end.
+ */
+static const square_t EMPTY_RAY_ENDS[BOARD_SIZE(BOARD_PHYSICAL)][DIR_COUNT] = {
+    {0x70, 0x77, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00},  // a1
+    {0x71, 0x67, 0x07, 0x01, 0x01, 0x01, 0x00, 0x10},  // b1
+    {0x72, 0x57, 0x07, 0x02, 0x02, 0x02, 0x00, 0x20},  // c1
+    {0x73, 0x47, 0x07, 0x03, 0x03, 0x03, 0x00, 0x30},  // d1
+    {0x74, 0x37, 0x07, 0x04, 0x04, 0x04, 0x00, 0x40},  // e1
+    {0x75, 0x27, 0x07, 0x05, 0x05, 0x05, 0x00, 0x50},  // f1
+    {0x76, 0x17, 0x07, 0x06, 0x06, 0x06, 0x00, 0x60},  // g1
+    {0x77, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x70},  // h1
+    {0x70, 0x76, 0x17, 0x01, 0x00, 0x10, 0x10, 0x10},  // a2
+    {0x71, 0x77, 0x17, 0x02, 0x01, 0x00, 0x10, 0x20},  // b2
+    {0x72, 0x67, 0x17, 0x03, 0x02, 0x01, 0x10, 0x30},  // c2
+    {0x73, 0x57, 0x17, 0x04, 0x03, 0x02, 0x10, 0x40},  // d2
+    {0x74, 0x47, 0x17, 0x05, 0x04, 0x03, 0x10, 0x50},  // e2
+    {0x75, 0x37, 0x17, 0x06, 0x05, 0x04, 0x10, 0x60},  // f2
+    {0x76, 0x27, 0x17, 0x07, 0x06, 0x05, 0x10, 0x70},  // g2
+    {0x77, 0x17, 0x17, 0x17, 0x07, 0x06, 0x10, 0x71},  // h2
+    {0x70, 0x75, 0x27, 0x02, 0x00, 0x20, 0x20, 0x20},  // a3
+    {0x71, 0x76, 0x27, 0x03, 0x01, 0x10, 0x20, 0x30},  // b3
+    {0x72, 0x77, 0x27, 0x04, 0x02, 0x00, 0x20, 0x40},  // c3
+    {0x73, 0x67, 0x27, 0x05, 0x03, 0x01, 0x20, 0x50},  // d3
+    {0x74, 0x57, 0x27, 0x06, 0x04, 0x02, 0x20, 0x60},  // e3
+    {0x75, 0x47, 0x27, 0x07, 0x05, 0x03, 0x20, 0x70},  // f3
+    {0x76, 0x37, 0x27, 0x17, 0x06, 0x04, 0x20, 0x71},  // g3
+    {0x77, 0x27, 0x27, 0x27, 0x07, 0x05, 0x20, 0x72},  // h3
+    {0x70, 0x74, 0x37, 0x03, 0x00, 0x30, 0x30, 0x30},  // a4
+    {0x71, 0x75, 0x37, 0x04, 0x01, 0x20, 0x30, 0x40},  // b4
+    {0x72, 0x76, 0x37, 0x05, 0x02, 0x10, 0x30, 0x50},  // c4
+    {0x73, 0x77, 0x37, 0x06, 0x03, 0x00, 0x30, 0x60},  // d4
+    {0x74, 0x67, 0x37, 0x07, 0x04, 0x01, 0x30, 0x70},  // e4
+    {0x75, 0x57, 0x37, 0x17, 0x05, 0x02, 0x30, 0x71},  // f4
+    {0x76, 0x47, 0x37, 0x27, 0x06, 0x03, 0x30, 0x72},  // g4
+    {0x77, 0x37, 0x37, 0x37, 0x07, 0x04, 0x30, 0x73},  // h4
+    {0x70, 0x73, 0x47, 0x04, 0x00, 0x40, 0x40, 0x40},  // a5
+    {0x71, 0x74, 0x47, 0x05, 0x01, 0x30, 0x40, 0x50},  // b5
+    {0x72, 0x75, 0x47, 0x06, 0x02, 0x20, 0x40, 0x60},  // c5
+    {0x73, 0x76, 0x47, 0x07, 0x03, 0x10, 0x40, 0x70},  // d5
+    {0x74, 0x77, 0x47, 0x17, 0x04, 0x00, 0x40, 0x71},  // e5
+    {0x75, 0x67, 0x47, 0x27, 0x05, 0x01, 0x40, 0x72},  // f5
+    {0x76, 0x57, 0x47, 0x37, 0x06, 0x02, 0x40, 0x73},  // g5
+    {0x77, 0x47, 0x47, 0x47, 0x07, 0x03, 0x40, 0x74},  // h5
+    {0x70, 0x72, 0x57, 0x05, 0x00, 0x50, 0x50, 0x50},  // a6
+    {0x71, 0x73, 0x57, 0x06, 0x01, 0x40, 0x50, 0x60},  // b6
+    {0x72, 0x74, 0x57, 0x07, 0x02, 0x30, 0x50, 0x70},  // c6
+    {0x73, 0x75, 0x57, 0x17, 0x03, 0x20, 0x50, 0x71},  // d6
+    {0x74, 0x76, 0x57, 0x27, 0x04, 0x10, 0x50, 0x72},  // e6
+    {0x75, 0x77, 0x57, 0x37, 0x05, 0x00, 0x50, 0x73},  // f6
+    {0x76, 0x67, 0x57, 0x47, 0x06, 0x01, 0x50, 0x74},  // g6
+    {0x77, 0x57, 0x57, 0x57, 0x07, 0x02, 0x50, 0x75},  // h6
+    {0x70, 0x71, 0x67, 0x06, 0x00, 0x60, 0x60, 0x60},  // a7
+    {0x71, 0x72, 0x67, 0x07, 0x01, 0x50, 0x60, 0x70},  // b7
+    {0x72, 0x73, 0x67, 0x17, 0x02, 0x40, 0x60, 0x71},  // c7
+    {0x73, 0x74, 0x67, 0x27, 0x03, 0x30, 0x60, 0x72},  // d7
+    {0x74, 0x75, 0x67, 0x37, 0x04, 0x20, 0x60, 0x73},  // e7
+    {0x75, 0x76, 0x67, 0x47, 0x05, 0x10, 0x60, 0x74},  // f7
+    {0x76, 0x77, 0x67, 0x57, 0x06, 0x00, 0x60, 0x75},  // g7
+    {0x77, 0x67, 0x67, 0x67, 0x07, 0x01, 0x60, 0x76},  // h7
+    {0x70, 0x70, 0x77, 0x07, 0x00, 0x70, 0x70, 0x70},  // a8
+    {0x71, 0x71, 0x77, 0x17, 0x01, 0x60, 0x70, 0x71},  // b8
+    {0x72, 0x72, 0x77, 0x27, 0x02, 0x50, 0x70, 0x72},  // c8
+    {0x73, 0x73, 0x77, 0x37, 0x03, 0x40, 0x70, 0x73},  // d8
+    {0x74, 0x74, 0x77, 0x47, 0x04, 0x30, 0x70, 0x74},  // e8
+    {0x75, 0x75, 0x77, 0x57, 0x05, 0x20, 0x70, 0x75},  // f8
+    {0x76, 0x76, 0x77, 0x67, 0x06, 0x10, 0x70, 0x76},  // g8
+    {0x77, 0x77, 0x77, 0x77, 0x07, 0x00, 0x70, 0x77},  // h8
+};
+
+/**
+ * @brief Patch the ray table after a square became occupied or empty
+ * @param board    Board whose ray table is updated
+ * @param square   Square whose occupancy changed
+ * @param occupied true if the square now holds a piece
+ *
+ * For each direction, only the squares looking at `square` from behind (up
+ * to and including the first occupied one) can have a different ray end.
+ */
+static void update_ray_ends(board_t* board, square_t square, bool occupied) {
+    for (uint8_t dir = 0; dir < DIR_COUNT; ++dir) {
+        int8_t back = DIRECTION_OFFSETS[OPPOSITE_DIR(dir)];
+        square_t end = occupied ? square : board_ray_end(board, square, dir);
+
+        for (square_t from = square + back; is_valid_square(from); from += back) {
+            board->ray_end[SQUARE_TO_INDEX(from)][dir] = end;
+            if (board->squares[from] != PIECE_NONE) {
+                break;
+            }
+        }
+    }
+}
+
 void board_init(board_t* board) {
     board_clear(board);
 }
@@ -16,6 +117,8 @@ void board_clear(board_t* board) {
     /* Initialize required non-zero defaults */
     board->en_passant_square = NO_SQUARE;
     board->fullmove_number = 1;
+    board->revision = ++revision_counter;
+    memcpy(board->ray_end, EMPTY_RAY_ENDS, sizeof(EMPTY_RAY_ENDS));
 }
 
 void board_reset(board_t* board) {
@@ -65,7 +168,14 @@ void board_set_piece(board_t* board, square_t square, piece_t piece) {
         return;
     }
 
+    piece_t previous = board->squares[square];
     board->squares[square] = piece;
+    board->key ^= zobrist_piece(previous, square) ^ zobrist_piece(piece, square);
+    board->revision = ++revision_counter;
+
+    if ((previous == PIECE_NONE) != (piece == PIECE_NONE)) {
+        update_ray_ends(board, square, piece != PIECE_NONE);
+    }
 
     /* Update king position tracking if needed */
     if (IS_PIECE_TYPE(piece, PIECE_KING)) {
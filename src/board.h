@@ -72,6 +72,26 @@ typedef enum {
     SIDE_COUNT  /**< Number of sides */
 } side_t;
 
+/**
+ * @brief Ray direction enumeration
+ *
+ * Ordered clockwise starting from north so that even indices are orthogonal
+ * (rook) directions, odd indices are diagonal (bishop) directions, and the
+ * opposite of a direction is always `dir ^ 4`.
+ * @see DIRECTION_OFFSETS for the matching 0x88 square deltas
+ */
+typedef enum {
+    DIR_NORTH,      /**< Toward rank 8 (+16) */
+    DIR_NORTH_EAST, /**< Toward h8 (+17) */
+    DIR_EAST,       /**< Toward file h (+1) */
+    DIR_SOUTH_EAST, /**< Toward h1 (-15) */
+    DIR_SOUTH,      /**< Toward rank 1 (-16) */
+    DIR_SOUTH_WEST, /**< Toward a1 (-17) */
+    DIR_WEST,       /**< Toward file a (-1) */
+    DIR_NORTH_WEST, /**< Toward a8 (+15) */
+    DIR_COUNT       /**< Number of ray directions */
+} direction_t;
+
 /**
  * @brief Castling rights representation
  *
@@ -87,6 +107,32 @@ typedef uint8_t castling_rights_t;
  */
 typedef uint16_t move_count_t;
 
+/**
+ * @brief Zobrist position key width in bits
+ *
+ * One of 24, 32, 48 or 64. Narrow keys are cheap single-word operations on the
+ * eZ80 but collide more often; override with -DZOBRIST_KEY_BITS=<n>.
+ */
+#ifndef ZOBRIST_KEY_BITS
+#define ZOBRIST_KEY_BITS 32
+#endif
+
+/**
+ * @brief Zobrist position key
+ * @see zobrist.h
+ */
+#if ZOBRIST_KEY_BITS == 24
+typedef uint24_t zobrist_key_t;
+#elif ZOBRIST_KEY_BITS == 32
+typedef uint32_t zobrist_key_t;
+#elif ZOBRIST_KEY_BITS == 48
+typedef uint48_t zobrist_key_t;
+#elif ZOBRIST_KEY_BITS == 64
+typedef uint64_t zobrist_key_t;
+#else
+#error "ZOBRIST_KEY_BITS must be 24, 32, 48 or 64"
+#endif
+
 /**
  * @brief Square representation in 0x88 format
  *
@@ -167,6 +213,7 @@ typedef uint8_t piece_t;
 #define SQUARE_TO_FILE(square)          ((square) & BOARD_FILE_MASK)
 #define SQUARE_TO_RANK(square)          ((square) >> BOARD_RANK_SHIFT)
 #define FILE_RANK_TO_SQUARE(file, rank) (((rank) << BOARD_RANK_SHIFT) | (file))
+#define SQUARE_TO_INDEX(square)         (((square) + SQUARE_TO_FILE(square)) >> 1)  // 0..63
 
 #define MAKE_PIECE(color, type)      ((color) | (type))
 #define GET_PIECE_TYPE(piece)        ((piece) & PIECE_MASK)
@@ -176,14 +223,60 @@ typedef uint8_t piece_t;
 
 #define COLOR_TO_SIDE(color) ((color) == PIECE_WHITE ? SIDE_WHITE : SIDE_BLACK)
 #define SIDE_TO_COLOR(side)  ((side) == SIDE_WHITE ? PIECE_WHITE : PIECE_BLACK)
+#define OPPOSITE_SIDE(side)  ((side_t)((side) ^ 1))
 
 #define INVALID_SQUARE(sq) ((sq) & 0x88)
+
+#define IS_DIAGONAL_DIR(dir) ((dir) & 1)
+#define OPPOSITE_DIR(dir)    ((dir) ^ 4)
+
+/**
+ * @brief Force inlining of a side-generic helper
+ *
+ * Helpers taking a `side_t` argument are marked ALWAYS_INLINE and called with
+ * a constant side from one wrapper per color, so pawn directions, home ranks
+ * and piece codes become immediates instead of run-time branches.
+ */
+#define ALWAYS_INLINE inline __attribute__((always_inline))
 /** @} */
 
+/**
+ * @brief 0x88 square delta for each direction_t
+ *
+ * Adding a delta to a valid square yields the neighbouring square in that
+ * direction, or a square failing INVALID_SQUARE() when stepping off the board.
+ */
+extern const int8_t DIRECTION_OFFSETS[DIR_COUNT];
+
 // ==========================
 //         Data Types
 // ==========================
 
+/**
+ * @brief Check and pin limits
+ * @{
+ */
+#define MAX_PINNED   DIR_COUNT /**< One absolutely pinned piece per ray */
+#define MAX_EVASIONS 7         /**< Capture or interpose squares against a distant slider */
+/** @} */
+
+/**
+ * @brief Checking and pinned pieces of one side's king
+ *
+ * Filled by compute_check_info() (attack.h). The copy cached in board_t is
+ * only trusted while `revision` and `side` still match the board.
+ */
+typedef struct {
+    uint24_t revision;               /**< board_t::revision the info was computed for */
+    side_t side;                     /**< Side whose king was examined */
+    uint8_t num_checkers;            /**< Enemy pieces giving check (above 2 only if illegal) */
+    square_t checkers[2];            /**< Squares of the first two checking pieces */
+    uint8_t num_evasions;            /**< Entries in evasions (0 unless in single check) */
+    square_t evasions[MAX_EVASIONS]; /**< Capture and interposition squares */
+    uint8_t num_pinned;              /**< Absolutely pinned friendly pieces */
+    square_t pinned[MAX_PINNED];     /**< Squares of the pinned pieces */
+} check_info_t;
+
 /**
  * @brief Complete chess board state representation
  *
@@ -198,6 +291,17 @@ typedef struct {
     square_t en_passant_square;                 /**< Valid en passant target or NO_SQUARE */
     move_count_t halfmove_clock;                /**< Moves since pawn move or capture */
     move_count_t fullmove_number;               /**< Complete game moves */
+    zobrist_key_t key;                          /**< Zobrist hash of the position */
+    uint24_t revision;                          /**< Stamp of the last change, for caches */
+    check_info_t check_info;                    /**< Checkers and pins of the side to move */
+
+    /**
+     * Nearest occupied square from each square in each direction, or the
+     * last on-board square of that ray if it is empty (the square itself
+     * when it already sits on that edge). Kept current by board_set_piece().
+     * Indexed by SQUARE_TO_INDEX(); read it through board_ray_end().
+     */
+    square_t ray_end[BOARD_SIZE(BOARD_PHYSICAL)][DIR_COUNT];
 } board_t;
 
 // ==========================
@@ -210,6 +314,10 @@ typedef struct {
  *
  * Creates an empty board with default values for all fields.
  * All squares are set to PIECE_NONE and move counters are reset.
+ *
+ * Every change made through board_clear() or board_set_piece() stores a
+ * stamp in board->revision that is unique across all boards, so caches can
+ * detect a changed position by comparing the board address and revision.
  */
 void board_init(board_t* board);
 
@@ -315,6 +423,17 @@ static inline uint8_t square_to_rank(square_t square) {
     return SQUARE_TO_RANK(square);
 }
 
+/**
+ * @brief Get the nearest blocker from a square in one direction
+ * @param board  Board to query
+ * @param square Valid square in 0x88 format
+ * @param dir    Direction to look in
+ * @return square_t First occupied square, or the last on-board square of an empty ray
+ */
+static inline square_t board_ray_end(const board_t* board, square_t square, uint8_t dir) {
+    return board->ray_end[SQUARE_TO_INDEX(square)][dir];
+}
+
 // ========================
 //    Piece Manipulation
 // ========================
@@ -327,6 +446,11 @@ static inline uint8_t square_to_rank(square_t square) {
  *
  * Places a piece on the board and updates king tracking if needed.
  * Setting PIECE_NONE effectively removes any piece at that square.
+ * Gives the board a fresh revision stamp so position-derived caches rebuild.
+ *
+ * When the square changes between empty and occupied, board->ray_end is
+ * patched only along the rays that pass through it. The piece part of
+ * board->key is updated incrementally.
  */
 void board_set_piece(board_t* board, square_t square, piece_t piece);
 
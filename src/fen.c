@@ -1,6 +1,9 @@
 #include "fen.h"
 
+#include "attack.h"
 #include "board.h"
+#include "profile.h"
+#include "zobrist.h"
 
 #include <ctype.h>
 #include <stdbool.h>
@@ -154,6 +157,8 @@ static void write_en_passant(const board_t* board, writer_t* writer);
 static void write_move_counters(const board_t* board, writer_t* writer);
 
 bool board_set_fen(board_t* board, const char* fen) {
+    PROFILE_ZONE("fen: parse");
+
     if (!fen) {
         return false;
     }
@@ -192,6 +197,13 @@ bool board_set_fen(board_t* board, const char* fen) {
 
     parse_fullmove_number(board, &parser);
 
+    if (parser.success) {
+        /* Pieces were hashed as they were placed; add the remaining state */
+        board->key ^=
+            zobrist_state(board->side_to_move, board->castling_rights, board->en_passant_square);
+        board_update_check_info(board);
+    }
+
     return parser.success;
 }
 
@@ -223,6 +235,98 @@ void board_get_fen(const board_t* board, char* fen, size_t len) {
     }
 }
 
+bool fen_to_key(const char* fen, size_t len, zobrist_key_t* key) {
+    if (!fen || !key) {
+        return false;
+    }
+
+    const char* ptr = fen;
+    const char* end = fen + len;
+    zobrist_key_t pieces = 0;
+
+    /* Piece placement, with the same rules as parse_piece_placement() */
+    int8_t rank = BOARD_HEIGHT(BOARD_PHYSICAL) - 1;
+    uint8_t file = 0;
+    for (; ptr < end && *ptr != ' '; ++ptr) {
+        char c = *ptr;
+
+        if (c == '/') {
+            if (file != BOARD_WIDTH(BOARD_PHYSICAL)) {
+                return false;
+            }
+            rank--;
+            file = 0;
+        } else if (c >= '1' && c <= '0' + BOARD_WIDTH(BOARD_PHYSICAL)) {
+            file += c - '0';
+        } else {
+            piece_t piece = char_to_piece(c);
+            if (piece == PIECE_NONE || file >= BOARD_WIDTH(BOARD_PHYSICAL) || rank < 0) {
+                return false;
+            }
+            pieces ^= zobrist_piece(piece, FILE_RANK_TO_SQUARE(file, rank));
+            file++;
+        }
+    }
+    if (rank != 0 || file != BOARD_WIDTH(BOARD_PHYSICAL) || end - ptr < 2) {
+        return false;
+    }
+
+    /* Side to move */
+    side_t side;
+    switch (*++ptr) {
+        case 'w': side = SIDE_WHITE; break;
+        case 'b': side = SIDE_BLACK; break;
+        default: return false;
+    }
+    if (end - ++ptr < 2 || *ptr++ != ' ') {
+        return false;
+    }
+
+    /* Castling rights */
+    castling_rights_t rights = CASTLE_NONE;
+    if (*ptr == '-') {
+        ptr++;
+    } else {
+        for (; ptr < end && *ptr != ' '; ++ptr) {
+            switch (*ptr) {
+                case 'K': rights |= CASTLE_WK; break;
+                case 'Q': rights |= CASTLE_WQ; break;
+                case 'k': rights |= CASTLE_BK; break;
+                case 'q': rights |= CASTLE_BQ; break;
+                default: return false;
+            }
+        }
+    }
+    if (end - ptr < 2 || *ptr++ != ' ') {
+        return false;
+    }
+
+    /* En passant target */
+    square_t en_passant = NO_SQUARE;
+    if (*ptr != '-') {
+        if (end - ptr < SQUARE_STR_LEN) {
+            return false;
+        }
+        uint8_t ep_file = ptr[0] - 'a';
+        uint8_t ep_rank = ptr[1] - '1';
+        if (ep_file >= BOARD_WIDTH(BOARD_PHYSICAL) || ep_rank >= BOARD_HEIGHT(BOARD_PHYSICAL)) {
+            return false;
+        }
+        en_passant = FILE_RANK_TO_SQUARE(ep_file, ep_rank);
+        ptr += SQUARE_STR_LEN;
+    } else {
+        ptr++;
+    }
+
+    /* The move counters or EPD operations must start a new field */
+    if (ptr < end && *ptr != ' ') {
+        return false;
+    }
+
+    *key = pieces ^ zobrist_state(side, rights, en_passant);
+    return true;
+}
+
 static parser_t parser_create(const char* fen) {
     return (parser_t){.ptr = fen, .success = true};
 }
@@ -26,6 +26,13 @@ extern "C" {
 /** Minimum length needed for a valid FEN string buffer */
 #define FEN_MIN_LEN 24
 
+/**
+ * Buffer length that fits any FEN, including the terminator. The longest
+ * position text is 82 characters, and board_get_fen() wants more than 16
+ * bytes left before it writes the move counters.
+ */
+#define FEN_MAX_LEN 100
+
 /** Standard chess starting position in FEN notation */
 #define INITIAL_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
 
@@ -38,7 +45,9 @@ extern "C" {
  *
  * Parses a FEN string and sets up the corresponding position on the board. The
  * board is cleared before parsing begins. If parsing fails, the board remains
- * in a cleared state.
+ * in a cleared state. On success board->key holds the Zobrist key of the
+ * position and the check and pin info of the side to move is cached in
+ * board->check_info.
  */
 bool board_set_fen(board_t* board, const char* fen);
 
@@ -53,6 +62,24 @@ bool board_set_fen(board_t* board, const char* fen);
  */
 void board_get_fen(const board_t* board, char* fen, size_t len);
 
+/**
+ * @brief Compute the Zobrist key of a FEN without setting up a board
+ * @param fen FEN or EPD text, not necessarily null-terminated
+ * @param len Number of characters available at fen
+ * @param key Receives the key equal to board->key after board_set_fen();
+ *            left untouched on failure
+ * @return true if the placement, side, castling and en passant fields are
+ *         valid
+ *
+ * Only the first four fields are read, and each is checked as strictly as
+ * board_set_fen() checks it. The fourth field must be followed by a space or
+ * the end of the input; move counters and any EPD operations after it are
+ * ignored. Meant for key-only ingestion of large text datasets
+ * (deduplication, book lookups), so it touches no board_t and allocates
+ * nothing. Requires zobrist_init() to have been called.
+ */
+bool fen_to_key(const char* fen, size_t len, zobrist_key_t* key);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,82 @@
+/**
+ * @file game.c
+ * @brief Implementation of the game record
+ */
+
+#include "game.h"
+
+#include "fen.h"
+
+// ==========================
+//     Public Functions
+// ==========================
+
+bool game_init(game_t* game, const char* fen) {
+    game->ply = 0;
+    game->length = 0;
+    board_init(&game->board);
+    return board_set_fen(&game->board, fen);
+}
+
+bool game_play_move(game_t* game, move_t move) {
+    /* Replaying the recorded move keeps the rest of the line */
+    if (game->ply < game->length && game->history[game->ply].move == move) {
+        return game_redo(game);
+    }
+
+    if (game->ply >= GAME_MAX_PLIES) {
+        return false;
+    }
+
+    board_make_move(&game->board, move, &game->history[game->ply]);
+    game->length = ++game->ply;
+    return true;
+}
+
+bool game_undo(game_t* game) {
+    if (game->ply == 0) {
+        return false;
+    }
+
+    board_unmake_move(&game->board, &game->history[--game->ply]);
+    return true;
+}
+
+bool game_redo(game_t* game) {
+    if (game->ply >= game->length) {
+        return false;
+    }
+
+    undo_t* undo = &game->history[game->ply++];
+    board_make_move(&game->board, undo->move, undo);
+    return true;
+}
+
+bool game_goto_ply(game_t* game, uint16_t ply) {
+    if (ply > game->length) {
+        return false;
+    }
+
+    while (game->ply > ply) {
+        game_undo(game);
+    }
+    while (game->ply < ply) {
+        game_redo(game);
+    }
+    return true;
+}
+
+bool game_key_at(const game_t* game, uint16_t ply, zobrist_key_t* key) {
+    if (ply == game->ply) {
+        *key = game->board.key;
+        return true;
+    }
+
+    /* Past the current ply the pre-move keys were recorded when first played */
+    if (ply >= game->length) {
+        return false;
+    }
+
+    *key = game->history[ply].key;
+    return true;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file game.h
+ * @brief Game record with takeback, redo and move-list navigation
+ *
+ * A game owns its board and a fixed-size history of undo records, one per
+ * ply, each holding the move and the key of the position it was played
+ * from. The current ply can sit anywhere inside the recorded line: plies
+ * before it are taken back with board_unmake_move() and plies after it are
+ * replayed with board_make_move(), so navigating never re-parses the
+ * starting FEN or replays the game from the first move.
+ *
+ * Playing a new move from the middle of the line discards the plies after
+ * it, unless it is the move already recorded there, in which case the rest
+ * of the line is kept for redo.
+ */
+
+#pragma once
+
+#include "board.h"
+#include "makemove.h"
+#include "move.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Most plies a game can record */
+#define GAME_MAX_PLIES 512
+
+/**
+ * @brief Game state and history
+ */
+typedef struct {
+    board_t board;                  /**< Position at the current ply */
+    uint16_t ply;                   /**< Current ply (0 = starting position) */
+    uint16_t length;                /**< Number of recorded plies */
+    undo_t history[GAME_MAX_PLIES]; /**< Undo record of each recorded ply */
+} game_t;
+
+/**
+ * @brief Start a game from a position
+ * @param game Game to initialize
+ * @param fen  Starting position, e.g. INITIAL_FEN
+ * @return true if the FEN was valid
+ */
+bool game_init(game_t* game, const char* fen);
+
+/**
+ * @brief Play a move at the current ply
+ * @param game Game to update
+ * @param move Legal move for the side to move
+ * @return true if the move was recorded, false if the history is full
+ */
+bool game_play_move(game_t* game, move_t move);
+
+/**
+ * @brief Take back one ply
+ * @param game Game to update
+ * @return true if a ply was taken back
+ */
+bool game_undo(game_t* game);
+
+/**
+ * @brief Replay one previously taken back ply
+ * @param game Game to update
+ * @return true if a ply was replayed
+ */
+bool game_redo(game_t* game);
+
+/**
+ * @brief Move to any recorded ply
+ * @param game Game to update
+ * @param ply  Target ply, 0 to game->length
+ * @return true if the target ply exists
+ *
+ * Costs one unmake or make per ply between the current and target ply.
+ */
+bool game_goto_ply(game_t* game, uint16_t ply);
+
+/**
+ * @brief Get the move played at a ply
+ * @param game Game to query
+ * @param ply  Ply index, 0 to game->length - 1
+ * @return move_t Recorded move, or 0 if out of range
+ */
+static inline move_t game_move_at(const game_t* game, uint16_t ply) {
+    return ply < game->length ? game->history[ply].move : 0;
+}
+
+/**
+ * @brief Get the key of the position before a ply
+ * @param game Game to query
+ * @param ply  Ply index, 0 to game->length
+ * @param key  Receives the key of the position at that ply; left untouched
+ *             on failure
+ * @return true if the key is known: false past game->length, and for the
+ *         final position of the line while it is not the current one
+ *
+ * Keys of earlier positions are what threefold repetition checks compare.
+ */
+bool game_key_at(const game_t* game, uint16_t ply, zobrist_key_t* key);
+
+#ifdef __cplusplus
+}
+#endif
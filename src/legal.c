@@ -0,0 +1,512 @@
+/**
+ * @file legal.c
+ * @brief Implementation of legal move queries
+ */
+
+#include "legal.h"
+
+#include "attack.h"
+#include "profile.h"
+
+#include <string.h>
+
+// ==========================
+//     Local Constants
+// ==========================
+
+/** Most pieces one side can have on the board */
+#define MAX_SIDE_PIECES 16
+
+/** Promotion choices, strongest first */
+static const piece_type_t PROMOTION_TYPES[4] = {PIECE_QUEEN, PIECE_ROOK, PIECE_BISHOP,
+                                                PIECE_KNIGHT};
+
+// ==========================
+//       Local Types
+// ==========================
+
+/**
+ * @brief Slice of the cached move list belonging to one origin square
+ */
+typedef struct {
+    square_t from; /**< Origin square of the moves */
+    uint8_t start; /**< Index of the first move in legal_cache_t::moves */
+    uint8_t count; /**< Number of moves from this square */
+} legal_group_t;
+
+/**
+ * @brief Legal moves of one position, grouped by origin square
+ *
+ * Valid while `board` and `revision` match the queried board.
+ */
+typedef struct {
+    const board_t* board;                  /**< Board the moves were generated for */
+    uint24_t revision;                     /**< board_t::revision at generation time */
+    uint8_t num_groups;                    /**< Number of pieces with legal moves */
+    legal_group_t groups[MAX_SIDE_PIECES]; /**< Per-square move slices */
+    move_t moves[LEGAL_MOVES_MAX];         /**< Legal moves, grouped by origin */
+} legal_cache_t;
+
+/**
+ * @brief Move generator state
+ *
+ * Collects legal moves for the side to move into a caller-provided buffer.
+ */
+typedef struct {
+    const board_t* board;     /**< Position being generated */
+    side_t side;              /**< Side to move */
+    piece_color_t color;      /**< Color of the side to move */
+    square_t king;            /**< King of the side to move, or NO_SQUARE if absent */
+    check_info_t scratch;     /**< Check info storage when the board cache is stale */
+    const check_info_t* info; /**< Checkers and pins of the side to move */
+    move_t* moves;            /**< Output buffer */
+    uint8_t count;            /**< Moves written so far */
+    uint8_t capacity;         /**< Size of the output buffer */
+} generator_t;
+
+/** Single position cache shared by all queries */
+static legal_cache_t cache;
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Set up a generator for the side to move
+ * @param gen      Generator state to fill
+ * @param board    Position to generate moves for
+ * @param moves    Output buffer
+ * @param capacity Size of the output buffer
+ */
+static void generator_init(generator_t* gen, const board_t* board, move_t* moves,
+                           uint8_t capacity) {
+    gen->board = board;
+    gen->side = board->side_to_move;
+    gen->color = SIDE_TO_COLOR(board->side_to_move);
+    gen->king = board->king_square[board->side_to_move];
+    gen->moves = moves;
+    gen->count = 0;
+    gen->capacity = capacity;
+
+    /* Boards set up without a king (e.g. in tests) skip the legality filter */
+    if (board->squares[gen->king] != MAKE_PIECE(gen->color, PIECE_KING)) {
+        gen->king = NO_SQUARE;
+    }
+
+    gen->info = board_check_info(board, &gen->scratch);
+}
+
+/**
+ * @brief Check that a move does not leave the mover's king attacked
+ * @param gen  Generator state
+ * @param move Pseudo-legal move (not castling)
+ * @return true if the move is legal
+ *
+ * Only king moves, en passant and moves of pinned pieces need a full attack
+ * test; everything else is settled by the check and pin info.
+ */
+static bool leaves_king_safe(const generator_t* gen, move_t move) {
+    if (gen->king == NO_SQUARE) {
+        return true;
+    }
+
+    square_t from = get_from_square(move);
+    square_t to = get_to_square(move);
+    bool en_passant = (get_special_type(move) == SPECIAL_EN_PASSANT);
+
+    if (from != gen->king && !en_passant) {
+        if (gen->info->num_checkers && !check_info_is_evasion(gen->info, to)) {
+            return false;
+        }
+        if (!check_info_is_pinned(gen->info, from)) {
+            return true;
+        }
+    }
+
+    square_t king = (from == gen->king) ? to : gen->king;
+
+    /* The en passant victim sits beside the capturing pawn, not on the target */
+    square_t captured = NO_SQUARE;
+    if (en_passant) {
+        captured = FILE_RANK_TO_SQUARE(SQUARE_TO_FILE(to), SQUARE_TO_RANK(from));
+    }
+
+    return !is_square_attacked_after(gen->board, king, OPPOSITE_SIDE(gen->side), from, captured,
+                                     to);
+}
+
+/**
+ * @brief Append a move if it is legal and there is room for it
+ * @param gen  Generator state
+ * @param move Pseudo-legal move
+ */
+static void add_move(generator_t* gen, move_t move) {
+    if (gen->count < gen->capacity && leaves_king_safe(gen, move)) {
+        gen->moves[gen->count++] = move;
+    }
+}
+
+/**
+ * @brief Append a move to a square, encoding a capture if it is occupied
+ * @param gen  Generator state
+ * @param from Origin square
+ * @param to   Destination square, empty or holding an enemy piece
+ */
+static void add_target(generator_t* gen, square_t from, square_t to) {
+    piece_t target = gen->board->squares[to];
+    if (target == PIECE_NONE) {
+        add_move(gen, make_move(from, to));
+    } else {
+        add_move(gen, make_capture(from, to, GET_PIECE_TYPE(target)));
+    }
+}
+
+/**
+ * @brief Append a pawn move, expanding it into all promotions on the last rank
+ * @param gen      Generator state
+ * @param from     Origin square
+ * @param to       Destination square
+ * @param captured Type of captured piece, or PIECE_NONE
+ * @param side     Side to move; a compile-time constant in every caller
+ */
+static ALWAYS_INLINE void add_pawn_move(generator_t* gen, square_t from, square_t to,
+                                        piece_type_t captured, const side_t side) {
+    const uint8_t last_rank = (side == SIDE_WHITE) ? 7 : 0;
+
+    if (SQUARE_TO_RANK(to) != last_rank) {
+        add_move(gen, captured ? make_capture(from, to, captured) : make_move(from, to));
+        return;
+    }
+
+    for (uint8_t i = 0; i < 4; ++i) {
+        add_move(gen, captured ? make_capture_promotion(from, to, captured, PROMOTION_TYPES[i])
+                               : make_promotion(from, to, PROMOTION_TYPES[i]));
+    }
+}
+
+/**
+ * @brief Check if a square can be entered (empty or enemy-occupied)
+ * @param gen    Generator state
+ * @param square Valid square
+ * @return true if the side to move may land on the square
+ */
+static inline bool can_land_on(const generator_t* gen, square_t square) {
+    piece_t piece = gen->board->squares[square];
+    return piece == PIECE_NONE || !IS_PIECE_COLOR(piece, gen->color);
+}
+
+/**
+ * @brief Generate pawn pushes, captures and en passant
+ * @param gen  Generator state
+ * @param from Pawn square
+ * @param side Side to move; a compile-time constant in every caller
+ */
+static ALWAYS_INLINE void generate_pawn_for(generator_t* gen, square_t from, const side_t side) {
+    const board_t* board = gen->board;
+    const piece_color_t color = SIDE_TO_COLOR(side);
+    const int8_t forward = (side == SIDE_WHITE) ? 16 : -16;
+    const uint8_t start_rank = (side == SIDE_WHITE) ? 1 : 6;
+
+    square_t to = from + forward;
+    if (is_valid_square(to) && board->squares[to] == PIECE_NONE) {
+        add_pawn_move(gen, from, to, PIECE_NONE, side);
+
+        square_t double_to = to + forward;
+        if (SQUARE_TO_RANK(from) == start_rank && board->squares[double_to] == PIECE_NONE) {
+            add_move(gen, make_move(from, double_to));
+        }
+    }
+
+    for (int8_t side_step = -1; side_step <= 1; side_step += 2) {
+        to = from + forward + side_step;
+        if (!is_valid_square(to)) {
+            continue;
+        }
+
+        piece_t target = board->squares[to];
+        if (target != PIECE_NONE && !IS_PIECE_COLOR(target, color)) {
+            add_pawn_move(gen, from, to, GET_PIECE_TYPE(target), side);
+        } else if (to == board->en_passant_square) {
+            add_move(gen, make_special(from, to, SPECIAL_EN_PASSANT));
+        }
+    }
+}
+
+/**
+ * @brief Generate knight jumps
+ * @param gen  Generator state
+ * @param from Knight square
+ */
+static void generate_knight(generator_t* gen, square_t from) {
+    const target_list_t* list = &KNIGHT_TARGETS[from];
+    for (uint8_t i = 0; i < list->count; ++i) {
+        if (can_land_on(gen, list->targets[i])) {
+            add_target(gen, from, list->targets[i]);
+        }
+    }
+}
+
+/**
+ * @brief Generate sliding moves along a subset of directions
+ * @param gen       Generator state
+ * @param from      Slider square
+ * @param first_dir First direction to walk
+ * @param dir_step  1 for all directions, 2 for orthogonal or diagonal only
+ */
+static void generate_slider(generator_t* gen, square_t from, uint8_t first_dir,
+                            uint8_t dir_step) {
+    for (uint8_t dir = first_dir; dir < DIR_COUNT; dir += dir_step) {
+        int8_t offset = DIRECTION_OFFSETS[dir];
+        square_t end = board_ray_end(gen->board, from, dir);
+        if (end == from) {
+            continue;
+        }
+
+        /* Everything short of the ray end is empty */
+        for (square_t to = from + offset; to != end; to += offset) {
+            add_move(gen, make_move(from, to));
+        }
+
+        if (can_land_on(gen, end)) {
+            add_target(gen, from, end);
+        }
+    }
+}
+
+/**
+ * @brief Generate castling moves for a king on its home square
+ * @param gen  Generator state
+ * @param from King square
+ * @param side Side to move; a compile-time constant in every caller
+ *
+ * Castling is only generated when the king, the squares it crosses and its
+ * destination are all unattacked, so no further legality check is needed.
+ */
+static ALWAYS_INLINE void generate_castles_for(generator_t* gen, square_t from,
+                                               const side_t side) {
+    const board_t* board = gen->board;
+    const bool white = (side == SIDE_WHITE);
+    const square_t home = white ? FILE_RANK_TO_SQUARE(4, 0) : FILE_RANK_TO_SQUARE(4, 7);
+    const castling_rights_t king_side = white ? CASTLE_WK : CASTLE_BK;
+    const castling_rights_t queen_side = white ? CASTLE_WQ : CASTLE_BQ;
+    const piece_t rook = MAKE_PIECE(SIDE_TO_COLOR(side), PIECE_ROOK);
+    const side_t enemy = OPPOSITE_SIDE(side);
+
+    if (from != home || !(board->castling_rights & (king_side | queen_side)) ||
+        is_square_attacked(board, home, enemy)) {
+        return;
+    }
+
+    if ((board->castling_rights & king_side) && board->squares[home + 1] == PIECE_NONE &&
+        board->squares[home + 2] == PIECE_NONE && board->squares[home + 3] == rook &&
+        !is_square_attacked(board, home + 1, enemy) &&
+        !is_square_attacked(board, home + 2, enemy) && gen->count < gen->capacity) {
+        gen->moves[gen->count++] = make_special(home, home + 2, SPECIAL_CASTLE_KING);
+    }
+
+    if ((board->castling_rights & queen_side) && board->squares[home - 1] == PIECE_NONE &&
+        board->squares[home - 2] == PIECE_NONE && board->squares[home - 3] == PIECE_NONE &&
+        board->squares[home - 4] == rook && !is_square_attacked(board, home - 1, enemy) &&
+        !is_square_attacked(board, home - 2, enemy) && gen->count < gen->capacity) {
+        gen->moves[gen->count++] = make_special(home, home - 2, SPECIAL_CASTLE_QUEEN);
+    }
+}
+
+/**
+ * @brief Generate single king steps
+ * @param gen  Generator state
+ * @param from King square
+ */
+static void generate_king_steps(generator_t* gen, square_t from) {
+    const target_list_t* list = &KING_TARGETS[from];
+    for (uint8_t i = 0; i < list->count; ++i) {
+        if (can_land_on(gen, list->targets[i])) {
+            add_target(gen, from, list->targets[i]);
+        }
+    }
+}
+
+/**
+ * @brief Generate all legal moves of the piece on a square
+ * @param gen  Generator state
+ * @param from Square holding a piece of the side to move
+ * @param side Side to move; a compile-time constant in every caller
+ */
+static ALWAYS_INLINE void generate_piece_for(generator_t* gen, square_t from, const side_t side) {
+    switch (GET_PIECE_TYPE(gen->board->squares[from])) {
+        case PIECE_PAWN: generate_pawn_for(gen, from, side); break;
+        case PIECE_KNIGHT: generate_knight(gen, from); break;
+        case PIECE_BISHOP: generate_slider(gen, from, DIR_NORTH_EAST, 2); break;
+        case PIECE_ROOK: generate_slider(gen, from, DIR_NORTH, 2); break;
+        case PIECE_QUEEN: generate_slider(gen, from, DIR_NORTH, 1); break;
+        case PIECE_KING:
+            generate_king_steps(gen, from);
+            generate_castles_for(gen, from, side);
+            break;
+        default: break;
+    }
+}
+
+/**
+ * @brief Fill the cache with the legal moves of one side
+ * @param board Board to generate legal moves for
+ * @param side  Side to move; a compile-time constant in every caller
+ */
+static ALWAYS_INLINE void cache_build_for(const board_t* board, const side_t side) {
+    const piece_color_t color = SIDE_TO_COLOR(side);
+
+    generator_t gen;
+    generator_init(&gen, board, cache.moves, LEGAL_MOVES_MAX);
+
+    /* In double check only the king may move */
+    bool king_only = (gen.info->num_checkers > 1);
+
+    cache.num_groups = 0;
+    for (square_t square = 0; square < BOARD_SIZE(BOARD_LOGICAL); ++square) {
+        if (INVALID_SQUARE(square)) {
+            square += BOARD_WIDTH(BOARD_PHYSICAL) - 1;  // Skip the off-board half of the rank
+            continue;
+        }
+
+        piece_t piece = board->squares[square];
+        if (piece == PIECE_NONE || !IS_PIECE_COLOR(piece, color) ||
+            (king_only && square != gen.king)) {
+            continue;
+        }
+
+        uint8_t start = gen.count;
+        generate_piece_for(&gen, square, side);
+
+        if (gen.count > start && cache.num_groups < MAX_SIDE_PIECES) {
+            cache.groups[cache.num_groups++] = (legal_group_t){
+                .from = square,
+                .start = start,
+                .count = gen.count - start,
+            };
+        }
+    }
+}
+
+/** @copydoc cache_build_for */
+static void cache_build_white(const board_t* board) {
+    cache_build_for(board, SIDE_WHITE);
+}
+
+/** @copydoc cache_build_for */
+static void cache_build_black(const board_t* board) {
+    cache_build_for(board, SIDE_BLACK);
+}
+
+/**
+ * @brief Regenerate the cache for a board
+ * @param board Board to generate legal moves for
+ */
+static void cache_build(const board_t* board) {
+    PROFILE_ZONE("legal: build cache");
+
+    /* Dispatch once; each variant has its pawn and castling code baked in */
+    if (board->side_to_move == SIDE_WHITE) {
+        cache_build_white(board);
+    } else {
+        cache_build_black(board);
+    }
+
+    cache.board = board;
+    cache.revision = board->revision;
+}
+
+/**
+ * @brief Search one side's pieces for any legal move
+ * @param board Board to query
+ * @param side  Side to move; a compile-time constant in every caller
+ * @return true if the side to move has at least one legal move
+ */
+static ALWAYS_INLINE bool has_legal_move_for(const board_t* board, const side_t side) {
+    const piece_color_t color = SIDE_TO_COLOR(side);
+
+    move_t move;
+    generator_t gen;
+    generator_init(&gen, board, &move, 1);
+
+    /* King steps are the cheapest to try and the only option in double check */
+    if (gen.king != NO_SQUARE) {
+        generate_king_steps(&gen, gen.king);
+        if (gen.count || gen.info->num_checkers > 1) {
+            return gen.count > 0;
+        }
+    }
+
+    /* Castling is never needed: if it is legal, so is the step toward the rook */
+    for (square_t square = 0; square < BOARD_SIZE(BOARD_LOGICAL); ++square) {
+        if (INVALID_SQUARE(square)) {
+            square += BOARD_WIDTH(BOARD_PHYSICAL) - 1;
+            continue;
+        }
+
+        piece_t piece = board->squares[square];
+        if (piece == PIECE_NONE || !IS_PIECE_COLOR(piece, color) || square == gen.king) {
+            continue;
+        }
+
+        generate_piece_for(&gen, square, side);
+        if (gen.count) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** @copydoc has_legal_move_for */
+static bool has_legal_move_white(const board_t* board) {
+    return has_legal_move_for(board, SIDE_WHITE);
+}
+
+/** @copydoc has_legal_move_for */
+static bool has_legal_move_black(const board_t* board) {
+    return has_legal_move_for(board, SIDE_BLACK);
+}
+
+// ==========================
+//     Public Functions
+// ==========================
+
+uint8_t legal_targets_from(const board_t* board, square_t square, move_t* out) {
+    if (!board || !out || !is_valid_square(square)) {
+        return 0;
+    }
+
+    if (cache.board != board || cache.revision != board->revision) {
+        cache_build(board);
+    }
+
+    for (uint8_t i = 0; i < cache.num_groups; ++i) {
+        const legal_group_t* group = &cache.groups[i];
+        if (group->from == square) {
+            memcpy(out, &cache.moves[group->start], group->count * sizeof(move_t));
+            return group->count;
+        }
+    }
+
+    return 0;
+}
+
+bool has_legal_move(const board_t* board) {
+    PROFILE_ZONE("legal: has move");
+
+    return board->side_to_move == SIDE_WHITE ? has_legal_move_white(board)
+                                             : has_legal_move_black(board);
+}
+
+bool is_in_check(const board_t* board) {
+    check_info_t scratch;
+    return board_check_info(board, &scratch)->num_checkers > 0;
+}
+
+bool is_checkmate(const board_t* board) {
+    return is_in_check(board) && !has_legal_move(board);
+}
+
+bool is_stalemate(const board_t* board) {
+    return !is_in_check(board) && !has_legal_move(board);
+}
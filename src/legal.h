@@ -0,0 +1,81 @@
+/**
+ * @file legal.h
+ * @brief Legal move queries for the side to move
+ *
+ * Serves per-square legal move lists for the calculator UI. The first query
+ * on a position generates every legal move once, grouped by origin square,
+ * and keeps the result in a single cache. Later queries on the same position
+ * (e.g. moving the selection cursor across pieces) are answered by copying
+ * the matching group without any regeneration.
+ *
+ * The cache is keyed by board address and board_t::revision, so any change
+ * made through board_set_piece(), board_clear() or board_set_fen()
+ * invalidates it automatically.
+ *
+ * has_legal_move() answers the game-over question without building a list:
+ * it tries king steps first, then the other pieces, and stops at the first
+ * legal move it finds.
+ */
+
+#pragma once
+
+#include "board.h"
+#include "move.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Most legal moves a single piece can have (queen in the centre) */
+#define LEGAL_TARGETS_MAX 27
+
+/** Most legal moves any reachable chess position can have */
+#define LEGAL_MOVES_MAX 218
+
+/**
+ * @brief Get the legal moves of the piece on a square
+ *
+ * @param board  Current board position
+ * @param square Origin square in 0x88 format
+ * @param out    Buffer of at least LEGAL_TARGETS_MAX moves
+ * @return uint8_t Number of moves written to out
+ *
+ * Returns 0 if the square is empty, invalid or holds a piece of the side not
+ * to move. Moves are fully encoded (captures, promotions, castling and en
+ * passant), so the destination of each is get_to_square(out[i]).
+ */
+uint8_t legal_targets_from(const board_t* board, square_t square, move_t* out);
+
+/**
+ * @brief Check if the side to move has at least one legal move
+ * @param board Current board position
+ * @return true if any legal move exists
+ *
+ * Does not touch the legal_targets_from() cache.
+ */
+bool has_legal_move(const board_t* board);
+
+/**
+ * @brief Check if the side to move is in check
+ * @param board Current board position
+ * @return true if the king of the side to move is attacked
+ */
+bool is_in_check(const board_t* board);
+
+/**
+ * @brief Check if the side to move is checkmated
+ * @param board Current board position
+ * @return true if in check with no legal move
+ */
+bool is_checkmate(const board_t* board);
+
+/**
+ * @brief Check if the side to move is stalemated
+ * @param board Current board position
+ * @return true if not in check but without a legal move
+ */
+bool is_stalemate(const board_t* board);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,6 @@
 #include "board.h"
+#include "profile.h"
+#include "zobrist.h"
 
 #include <debug.h>
 
@@ -9,10 +11,15 @@ int main(void) {
     dbg_printf("\n║          Chess Engine v0.1.0           ║");
     dbg_printf("\n╚════════════════════════════════════════╝\n");
 
+    profile_init();
+    zobrist_init();
+
     board_t board;
     board_init(&board);
     board_reset(&board);
     board_display(&board);
 
+    profile_report();
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,222 @@
+/**
+ * @file makemove.c
+ * @brief Implementation of make and unmake
+ */
+
+#include "makemove.h"
+
+#include "attack.h"
+#include "profile.h"
+#include "zobrist.h"
+
+// ==========================
+//     Local Constants
+// ==========================
+
+/** Home squares whose king or rook leaving (or being captured) drops rights */
+static const struct {
+    square_t square;          /**< King or rook home square */
+    castling_rights_t rights; /**< Rights lost when the square is touched */
+} CASTLING_SQUARES[] = {
+    {0x04, CASTLE_WK | CASTLE_WQ},  // e1
+    {0x07, CASTLE_WK},              // h1
+    {0x00, CASTLE_WQ},              // a1
+    {0x74, CASTLE_BK | CASTLE_BQ},  // e8
+    {0x77, CASTLE_BK},              // h8
+    {0x70, CASTLE_BQ},              // a8
+};
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Get the castling rights that survive a move
+ * @param rights Rights before the move
+ * @param from   Origin square
+ * @param to     Destination square
+ * @return castling_rights_t Rights after the move
+ */
+static castling_rights_t update_castling_rights(castling_rights_t rights, square_t from,
+                                                square_t to) {
+    for (uint8_t i = 0; rights && i < sizeof(CASTLING_SQUARES) / sizeof(CASTLING_SQUARES[0]);
+         ++i) {
+        if (from == CASTLING_SQUARES[i].square || to == CASTLING_SQUARES[i].square) {
+            rights &= ~CASTLING_SQUARES[i].rights;
+        }
+    }
+    return rights;
+}
+
+/**
+ * @brief Get the rook squares of a castling move
+ * @param special   SPECIAL_CASTLE_KING or SPECIAL_CASTLE_QUEEN
+ * @param side      Castling side; a compile-time constant in every caller
+ * @param rook_from Receives the rook's corner square
+ * @param rook_to   Receives the square the rook lands on
+ */
+static ALWAYS_INLINE void castling_rook_squares(uint8_t special, const side_t side,
+                                                square_t* rook_from, square_t* rook_to) {
+    const square_t back_rank = (side == SIDE_WHITE) ? 0x00 : 0x70;
+
+    if (special == SPECIAL_CASTLE_KING) {
+        *rook_from = back_rank + 7;
+        *rook_to = back_rank + 5;
+    } else {
+        *rook_from = back_rank;
+        *rook_to = back_rank + 3;
+    }
+}
+
+/**
+ * @brief Play a move for one side
+ * @param board Board to update
+ * @param move  Legal move
+ * @param undo  Receives the undo record
+ * @param side  Side to move; a compile-time constant in every caller
+ */
+static ALWAYS_INLINE void make_move_for(board_t* board, move_t move, undo_t* undo,
+                                        const side_t side) {
+    const int8_t forward = (side == SIDE_WHITE) ? 16 : -16;
+
+    square_t from = get_from_square(move);
+    square_t to = get_to_square(move);
+    uint8_t special = get_special_type(move);
+    piece_t piece = board->squares[from];
+
+    undo->move = move;
+    undo->captured = board->squares[to];
+    undo->castling_rights = board->castling_rights;
+    undo->en_passant_square = board->en_passant_square;
+    undo->halfmove_clock = board->halfmove_clock;
+    undo->key = board->key;
+
+    /* Drop the old state from the key; pieces are rehashed by board_set_piece() */
+    board->key ^= zobrist_state(side, board->castling_rights, board->en_passant_square);
+
+    if (special == SPECIAL_EN_PASSANT) {
+        /* The captured pawn stands just behind the target square */
+        square_t victim = to - forward;
+        undo->captured = board->squares[victim];
+        board_set_piece(board, victim, PIECE_NONE);
+    } else if (special != SPECIAL_NONE) {
+        square_t rook_from;
+        square_t rook_to;
+        castling_rook_squares(special, side, &rook_from, &rook_to);
+        board_set_piece(board, rook_to, board->squares[rook_from]);
+        board_set_piece(board, rook_from, PIECE_NONE);
+    }
+
+    piece_type_t promotion = get_promotion_type(move);
+    board_set_piece(board, from, PIECE_NONE);
+    board_set_piece(board, to, promotion ? MAKE_PIECE(SIDE_TO_COLOR(side), promotion) : piece);
+
+    bool pawn = IS_PIECE_TYPE(piece, PIECE_PAWN);
+    board->en_passant_square = NO_SQUARE;
+    if (pawn && to == from + 2 * forward) {
+        board->en_passant_square = from + forward;  // Square skipped by a double push
+    }
+
+    board->castling_rights = update_castling_rights(board->castling_rights, from, to);
+    board->halfmove_clock = (pawn || undo->captured != PIECE_NONE) ? 0 : board->halfmove_clock + 1;
+    if (side == SIDE_BLACK) {
+        board->fullmove_number++;
+    }
+    board->side_to_move = OPPOSITE_SIDE(side);
+
+    board->key ^= zobrist_state(board->side_to_move, board->castling_rights,
+                                board->en_passant_square);
+    board_update_check_info(board);
+}
+
+/** @copydoc make_move_for */
+static void make_white_move(board_t* board, move_t move, undo_t* undo) {
+    make_move_for(board, move, undo, SIDE_WHITE);
+}
+
+/** @copydoc make_move_for */
+static void make_black_move(board_t* board, move_t move, undo_t* undo) {
+    make_move_for(board, move, undo, SIDE_BLACK);
+}
+
+/**
+ * @brief Take back a move played by one side
+ * @param board Board to restore
+ * @param undo  Record filled when the move was made
+ * @param side  Side that played the move; a compile-time constant in every caller
+ */
+static ALWAYS_INLINE void unmake_move_for(board_t* board, const undo_t* undo, const side_t side) {
+    const int8_t forward = (side == SIDE_WHITE) ? 16 : -16;
+
+    move_t move = undo->move;
+    square_t from = get_from_square(move);
+    square_t to = get_to_square(move);
+    uint8_t special = get_special_type(move);
+    piece_t piece = board->squares[to];
+
+    if (get_promotion_type(move)) {
+        piece = MAKE_PIECE(SIDE_TO_COLOR(side), PIECE_PAWN);
+    }
+
+    board_set_piece(board, from, piece);
+    if (special == SPECIAL_EN_PASSANT) {
+        board_set_piece(board, to, PIECE_NONE);
+        board_set_piece(board, to - forward, undo->captured);
+    } else {
+        board_set_piece(board, to, undo->captured);
+    }
+
+    if (special == SPECIAL_CASTLE_KING || special == SPECIAL_CASTLE_QUEEN) {
+        square_t rook_from;
+        square_t rook_to;
+        castling_rook_squares(special, side, &rook_from, &rook_to);
+        board_set_piece(board, rook_from, board->squares[rook_to]);
+        board_set_piece(board, rook_to, PIECE_NONE);
+    }
+
+    if (side == SIDE_BLACK) {
+        board->fullmove_number--;
+    }
+    board->side_to_move = side;
+    board->castling_rights = undo->castling_rights;
+    board->en_passant_square = undo->en_passant_square;
+    board->halfmove_clock = undo->halfmove_clock;
+    board->key = undo->key;
+    board_update_check_info(board);
+}
+
+/** @copydoc unmake_move_for */
+static void unmake_white_move(board_t* board, const undo_t* undo) {
+    unmake_move_for(board, undo, SIDE_WHITE);
+}
+
+/** @copydoc unmake_move_for */
+static void unmake_black_move(board_t* board, const undo_t* undo) {
+    unmake_move_for(board, undo, SIDE_BLACK);
+}
+
+// ==========================
+//     Public Functions
+// ==========================
+
+void board_make_move(board_t* board, move_t move, undo_t* undo) {
+    PROFILE_ZONE("board: make move");
+
+    /* Dispatch once; each variant has its rook and en passant squares baked in */
+    if (board->side_to_move == SIDE_WHITE) {
+        make_white_move(board, move, undo);
+    } else {
+        make_black_move(board, move, undo);
+    }
+}
+
+void board_unmake_move(board_t* board, const undo_t* undo) {
+    PROFILE_ZONE("board: unmake move");
+
+    /* The side that played the move is the one not to move now */
+    if (board->side_to_move == SIDE_BLACK) {
+        unmake_white_move(board, undo);
+    } else {
+        unmake_black_move(board, undo);
+    }
+}
@@ -0,0 +1,55 @@
+/**
+ * @file makemove.h
+ * @brief Playing and taking back moves on a board
+ *
+ * board_make_move() applies a legal move in place and fills an undo record;
+ * board_unmake_move() restores the exact previous position from it. Both
+ * are O(1): every square change goes through board_set_piece(), which keeps
+ * the Zobrist key, king squares and ray table current, and the remaining
+ * state (castling rights, en passant square, halfmove clock, key) is copied
+ * into the undo record rather than recomputed.
+ */
+
+#pragma once
+
+#include "board.h"
+#include "move.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief State needed to take back one move
+ */
+typedef struct {
+    move_t move;                       /**< Move that was played */
+    piece_t captured;                  /**< Piece removed by the move, or PIECE_NONE */
+    castling_rights_t castling_rights; /**< Castling rights before the move */
+    square_t en_passant_square;        /**< En passant target before the move */
+    move_count_t halfmove_clock;       /**< Halfmove clock before the move */
+    zobrist_key_t key;                 /**< Position key before the move */
+} undo_t;
+
+/**
+ * @brief Play a move for the side to move
+ * @param board Board to update
+ * @param move  Legal move, as produced by legal_targets_from()
+ * @param undo  Receives what board_unmake_move() needs to take it back
+ *
+ * Updates castling rights, the en passant square, both move counters, the
+ * side to move and the key, then refreshes board->check_info for the new
+ * side to move.
+ */
+void board_make_move(board_t* board, move_t move, undo_t* undo);
+
+/**
+ * @brief Take back the last move played with board_make_move()
+ * @param board Board to restore
+ * @param undo  Record filled when the move was made
+ */
+void board_unmake_move(board_t* board, const undo_t* undo);
+
+#ifdef __cplusplus
+}
+#endif
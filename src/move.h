@@ -7,12 +7,17 @@
  * source/destination squares, piece types, and special move flags.
  *
  * Move bit layout (24 bits total):
- * [23-22] Special move type  (2 bits)
+ * [23-22] Move priority      (2 bits)
  * [21-19] Captured piece     (3 bits)
  * [18-16] Promotion piece    (3 bits)
- * [15-14] Move priority      (2 bits)
+ * [15-14] Special move type  (2 bits)
  * [13-07] To square         (7 bits)
  * [06-00] From square       (7 bits)
+ *
+ * The ordering fields sit in the high bits, most significant first, so
+ * comparing two raw move_t values orders them by priority, then victim
+ * value, then promotion piece. Sorting and picking the best move need no
+ * field extraction.
  */
 
 #pragma once
@@ -70,14 +75,14 @@ typedef enum {
 #define MOVE_FROM_BITS      7
 #define MOVE_TO_SHIFT       7
 #define MOVE_TO_BITS        7
-#define MOVE_PRIORITY_SHIFT 14
-#define MOVE_PRIORITY_BITS  2
+#define MOVE_SPECIAL_SHIFT  14
+#define MOVE_SPECIAL_BITS   2
 #define MOVE_PROMOTE_SHIFT  16
 #define MOVE_PROMOTE_BITS   3
 #define MOVE_CAPTURE_SHIFT  19
 #define MOVE_CAPTURE_BITS   3
-#define MOVE_SPECIAL_SHIFT  22
-#define MOVE_SPECIAL_BITS   2
+#define MOVE_PRIORITY_SHIFT 22
+#define MOVE_PRIORITY_BITS  2
 /** @} */
 
 /**
@@ -86,12 +91,24 @@ typedef enum {
  */
 #define MOVE_FROM_MASK     ((1UL << MOVE_FROM_BITS) - 1)
 #define MOVE_TO_MASK       ((1UL << MOVE_TO_BITS) - 1)
-#define MOVE_PRIORITY_MASK ((1UL << MOVE_PRIORITY_BITS) - 1)
+#define MOVE_SPECIAL_MASK  ((1UL << MOVE_SPECIAL_BITS) - 1)
 #define MOVE_PROMOTE_MASK  ((1UL << MOVE_PROMOTE_BITS) - 1)
 #define MOVE_CAPTURE_MASK  ((1UL << MOVE_CAPTURE_BITS) - 1)
-#define MOVE_SPECIAL_MASK  ((1UL << MOVE_SPECIAL_BITS) - 1)
+#define MOVE_PRIORITY_MASK ((1UL << MOVE_PRIORITY_BITS) - 1)
 /** @} */
 
+/**
+ * @brief Check if a move should be searched before another
+ * @param a First encoded move
+ * @param b Second encoded move
+ * @return true if a orders strictly ahead of b
+ *
+ * A single integer compare: priority, then captured piece, then promotion
+ * piece. Remaining ties fall back to the special/square bits, which keeps
+ * the order total and deterministic.
+ */
+#define MOVE_ORDERS_BEFORE(a, b) ((move_t)(a) > (move_t)(b))
+
 /**
  * @brief Move string length and buffer size constants
  * @{
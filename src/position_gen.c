@@ -0,0 +1,188 @@
+/**
+ * @file position_gen.c
+ * @brief Implementation of the random position generator
+ */
+
+#include "position_gen.h"
+
+#include "attack.h"
+#include "fen.h"
+#include "rng.h"
+#include "zobrist.h"
+
+/** Non-king pieces available to each side, indexed by piece type */
+static const uint8_t STANDARD_MATERIAL[PIECE_KING] = {
+    [PIECE_PAWN] = 8, [PIECE_KNIGHT] = 2, [PIECE_BISHOP] = 2, [PIECE_ROOK] = 2, [PIECE_QUEEN] = 1,
+};
+
+/** Non-king pieces in a full army */
+#define ARMY_SIZE 15
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Draw a random empty square
+ * @param board Board to place on
+ * @param seed  Generator state
+ * @param pawn  true to exclude the first and last ranks
+ * @return square_t Empty square in 0x88 format
+ */
+static square_t random_empty_square(const board_t* board, uint32_t* seed, bool pawn) {
+    square_t square;
+    do {
+        uint8_t file = rng_below(seed, 8);
+        uint8_t rank = pawn ? 1 + rng_below(seed, 6) : rng_below(seed, 8);
+        square = square_from_file_rank(file, rank);
+    } while (board->squares[square] != PIECE_NONE);
+    return square;
+}
+
+/**
+ * @brief Draw a piece type from a side's remaining material
+ * @param remaining Pieces left per type; the drawn type is decremented
+ * @param total     Sum of remaining (must be non-zero)
+ * @param seed      Generator state
+ * @return piece_type_t Drawn type
+ */
+static piece_type_t draw_piece_type(uint8_t* remaining, uint8_t total, uint32_t* seed) {
+    uint8_t pick = rng_below(seed, total);
+    piece_type_t type = PIECE_PAWN;
+    while (pick >= remaining[type]) {
+        pick -= remaining[type];
+        ++type;
+    }
+    --remaining[type];
+    return type;
+}
+
+/**
+ * @brief Clamp a piece count to what a position can hold
+ * @param num_pieces Requested total pieces, including kings
+ * @return uint8_t Count within POSITION_GEN_MIN_PIECES..POSITION_GEN_MAX_PIECES
+ */
+static uint8_t clamp_pieces(uint8_t num_pieces) {
+    if (num_pieces < POSITION_GEN_MIN_PIECES) {
+        return POSITION_GEN_MIN_PIECES;
+    }
+    if (num_pieces > POSITION_GEN_MAX_PIECES) {
+        return POSITION_GEN_MAX_PIECES;
+    }
+    return num_pieces;
+}
+
+/**
+ * @brief Grant the castling rights still possible from piece placement
+ * @param board Board to update
+ */
+static void grant_castling_rights(board_t* board) {
+    static const struct {
+        castling_rights_t right;
+        square_t king_square;
+        square_t rook_square;
+        piece_color_t color;
+    } CASTLES[] = {
+        {CASTLE_WK, 0x04, 0x07, PIECE_WHITE},
+        {CASTLE_WQ, 0x04, 0x00, PIECE_WHITE},
+        {CASTLE_BK, 0x74, 0x77, PIECE_BLACK},
+        {CASTLE_BQ, 0x74, 0x70, PIECE_BLACK},
+    };
+
+    for (uint8_t i = 0; i < sizeof(CASTLES) / sizeof(CASTLES[0]); ++i) {
+        piece_color_t color = CASTLES[i].color;
+        if (board->squares[CASTLES[i].king_square] == MAKE_PIECE(color, PIECE_KING) &&
+            board->squares[CASTLES[i].rook_square] == MAKE_PIECE(color, PIECE_ROOK)) {
+            board->castling_rights |= CASTLES[i].right;
+        }
+    }
+}
+
+/**
+ * @brief Make one placement attempt
+ * @param board      Board to set up
+ * @param seed       Generator state
+ * @param num_pieces Total pieces including kings (2-32)
+ * @return true if the result is a legal position
+ */
+static bool try_position(board_t* board, uint32_t* seed, uint8_t num_pieces) {
+    board_clear(board);
+
+    square_t white_king = random_empty_square(board, seed, false);
+    board_set_piece(board, white_king, MAKE_PIECE(PIECE_WHITE, PIECE_KING));
+    square_t black_king = random_empty_square(board, seed, false);
+    board_set_piece(board, black_king, MAKE_PIECE(PIECE_BLACK, PIECE_KING));
+
+    uint8_t remaining[SIDE_COUNT][PIECE_KING];
+    uint8_t totals[SIDE_COUNT] = {ARMY_SIZE, ARMY_SIZE};
+    for (uint8_t side = 0; side < SIDE_COUNT; ++side) {
+        for (uint8_t type = 0; type < PIECE_KING; ++type) {
+            remaining[side][type] = STANDARD_MATERIAL[type];
+        }
+    }
+
+    for (uint8_t placed = POSITION_GEN_MIN_PIECES; placed < num_pieces; ++placed) {
+        side_t side = (side_t)rng_below(seed, SIDE_COUNT);
+        if (totals[side] == 0) {
+            side = OPPOSITE_SIDE(side);
+        }
+
+        piece_type_t type = draw_piece_type(remaining[side], totals[side]--, seed);
+        square_t square = random_empty_square(board, seed, type == PIECE_PAWN);
+        board_set_piece(board, square, MAKE_PIECE(SIDE_TO_COLOR(side), type));
+    }
+
+    board->side_to_move = (side_t)rng_below(seed, SIDE_COUNT);
+    side_t waiting = OPPOSITE_SIDE(board->side_to_move);
+    if (is_square_attacked(board, board->king_square[waiting], board->side_to_move)) {
+        return false;
+    }
+
+    /* The count goes past two, so impossible triple checks show up here */
+    board_update_check_info(board);
+    if (board->check_info.num_checkers > 2) {
+        return false;
+    }
+
+    grant_castling_rights(board);
+    board->key ^= zobrist_state(board->side_to_move, board->castling_rights, NO_SQUARE);
+    return true;
+}
+
+// ==========================
+//     Public Functions
+// ==========================
+
+void position_gen_random(board_t* board, uint32_t* seed, uint8_t num_pieces) {
+    num_pieces = clamp_pieces(num_pieces);
+
+    while (!try_position(board, seed, num_pieces)) {
+        /* Redraw until legal; most placements are accepted */
+    }
+}
+
+void position_gen_corpus(uint32_t seed, uint16_t count, uint8_t min_pieces, uint8_t max_pieces,
+                         position_gen_emit_t emit, void* context) {
+    if (max_pieces < min_pieces) {
+        uint8_t swap = min_pieces;
+        min_pieces = max_pieces;
+        max_pieces = swap;
+    }
+
+    /* Clamp before cycling so out-of-range levels do not pile up at the limits */
+    min_pieces = clamp_pieces(min_pieces);
+    max_pieces = clamp_pieces(max_pieces);
+
+    board_t board;
+    char fen[FEN_MAX_LEN];
+    uint16_t span = (uint16_t)(max_pieces - min_pieces) + 1;
+
+    for (uint16_t i = 0; i < count; ++i) {
+        position_gen_random(&board, &seed, min_pieces + i % span);
+        board_get_fen(&board, fen, sizeof(fen));
+        if (fen[0] == '\0') {
+            continue; /* Writer failed; never hand out an empty FEN */
+        }
+        emit(fen, context);
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file position_gen.h
+ * @brief Seeded random legal position generator
+ *
+ * Builds positions by direct placement: both kings first, then the requested
+ * number of other pieces drawn from each side's standard material (so no
+ * side ever has more than 8 pawns, 2 knights and so on). Pawns never land on
+ * the first or last rank. A placement is kept only if the side not to move
+ * is not in check and the side to move faces at most two checkers;
+ * otherwise it is redrawn.
+ *
+ * Castling rights are granted wherever a king and rook still stand on their
+ * original squares. En passant is never set. Output is fully determined by
+ * the seed, so corpora can be regenerated instead of stored.
+ */
+
+#pragma once
+
+#include "board.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Fewest pieces in a position (the two kings) */
+#define POSITION_GEN_MIN_PIECES 2
+
+/** Most pieces in a position (full starting material) */
+#define POSITION_GEN_MAX_PIECES 32
+
+/**
+ * @brief Callback receiving each generated position
+ * @param fen     FEN of the position
+ * @param context User pointer passed to position_gen_corpus()
+ */
+typedef void (*position_gen_emit_t)(const char* fen, void* context);
+
+/**
+ * @brief Generate one random legal position
+ * @param board      Board to set up
+ * @param seed       Generator state, advanced by the call (must be non-zero)
+ * @param num_pieces Total pieces including kings, clamped to 2-32
+ *
+ * On return board->key and board->check_info are valid, as after
+ * board_set_fen().
+ */
+void position_gen_random(board_t* board, uint32_t* seed, uint8_t num_pieces);
+
+/**
+ * @brief Generate a phase-balanced corpus of random legal positions
+ * @param seed       Corpus seed (must be non-zero)
+ * @param count      Number of positions to generate
+ * @param min_pieces Fewest pieces per position, including kings
+ * @param max_pieces Most pieces per position, including kings
+ * @param emit       Called with the FEN of each position
+ * @param context    Passed through to emit
+ *
+ * Piece counts cycle through min_pieces..max_pieces, so every material
+ * level is equally represented. The bounds are swapped if given in reverse
+ * and clamped to POSITION_GEN_MIN_PIECES..POSITION_GEN_MAX_PIECES. A position whose FEN cannot be written is
+ * skipped rather than emitted as an empty string.
+ */
+void position_gen_corpus(uint32_t seed, uint16_t count, uint8_t min_pieces, uint8_t max_pieces,
+                         position_gen_emit_t emit, void* context);
+
+#ifdef __cplusplus
+}
+#endif
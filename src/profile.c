@@ -0,0 +1,103 @@
+/**
+ * @file profile.c
+ * @brief Implementation of the profiling zones
+ */
+
+#include "profile.h"
+
+#ifdef PROFILE
+
+#include <debug.h>
+
+#ifdef __TICE__
+#include <sys/timers.h>
+
+/** Timer 1 counts CPU cycles (48 MHz) */
+#define PROFILE_TIMER        1
+#define PROFILE_TICKS_PER_US 48
+#else
+#include <time.h>
+
+/** Host ticks are nanoseconds */
+#define PROFILE_TICKS_PER_US 1000
+#endif
+
+/** Head of the list of zones entered at least once */
+static profile_zone_t* zones;
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Read the free-running profiling timer
+ * @return uint32_t Current tick count (wraps around)
+ */
+static inline uint32_t read_ticks(void) {
+#ifdef __TICE__
+    return timer_Get(PROFILE_TIMER);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)now.tv_sec * 1000000000u + (uint32_t)now.tv_nsec;
+#endif
+}
+
+// ==========================
+//     Public Functions
+// ==========================
+
+void profile_init(void) {
+#ifdef __TICE__
+    timer_Disable(PROFILE_TIMER);
+    timer_Set(PROFILE_TIMER, 0);
+    timer_Enable(PROFILE_TIMER, TIMER_CPU, TIMER_NOINT, TIMER_UP);
+#endif
+}
+
+profile_scope_t profile_begin(profile_zone_t* zone) {
+    if (!zone->registered) {
+        zone->registered = true;
+        zone->next = zones;
+        zones = zone;
+    }
+
+    profile_scope_t scope = {zone, read_ticks()};
+    return scope;
+}
+
+void profile_end(profile_scope_t* scope) {
+    /* Unsigned subtraction stays correct across one timer wrap */
+    uint32_t elapsed = read_ticks() - scope->start;
+    scope->zone->calls++;
+    scope->zone->ticks += elapsed;
+}
+
+void profile_report(void) {
+    /* Insertion sort by total time, longest first */
+    profile_zone_t* sorted = 0;
+    while (zones) {
+        profile_zone_t* zone = zones;
+        zones = zone->next;
+
+        profile_zone_t** link = &sorted;
+        while (*link && (*link)->ticks >= zone->ticks) {
+            link = &(*link)->next;
+        }
+        zone->next = *link;
+        *link = zone;
+    }
+    zones = sorted;
+
+    dbg_printf("\n%-24s %10s %12s %8s\n", "zone", "calls", "total us", "avg ns");
+    for (profile_zone_t* zone = zones; zone; zone = zone->next) {
+        unsigned long total = (unsigned long)(zone->ticks / PROFILE_TICKS_PER_US);
+        unsigned long average =
+            zone->calls ? (unsigned long)(zone->ticks * 1000 / PROFILE_TICKS_PER_US / zone->calls)
+                        : 0;
+        dbg_printf("%-24s %10lu %12lu %8lu\n", zone->name, (unsigned long)zone->calls, total,
+                   average);
+    }
+}
+
+#endif
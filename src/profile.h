@@ -0,0 +1,97 @@
+/**
+ * @file profile.h
+ * @brief Lightweight hot-path profiling zones
+ *
+ * PROFILE_ZONE("name") at the top of a block counts how often the block runs
+ * and how long it takes until it is left. Each zone is a static record that
+ * registers itself on first use; the elapsed time is taken when the scope
+ * ends through the compiler's cleanup attribute, so early returns are
+ * measured correctly.
+ *
+ * Timing uses the CPU-clocked hardware timer on the calculator and
+ * clock_gettime() on a host build. Zones compile to nothing unless PROFILE is
+ * defined (`make PROFILE=1`), so release builds pay no cost.
+ *
+ * Nested zones each report their inclusive time.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef PROFILE
+
+/**
+ * @brief Accumulated statistics of one profiling zone
+ */
+typedef struct profile_zone {
+    const char* name;          /**< Label printed in the report */
+    uint32_t calls;            /**< Number of times the zone was entered */
+    uint64_t ticks;            /**< Total elapsed timer ticks */
+    bool registered;           /**< Zone is linked into the report list */
+    struct profile_zone* next; /**< Next registered zone */
+} profile_zone_t;
+
+/**
+ * @brief Active measurement of a zone, closed when it goes out of scope
+ */
+typedef struct {
+    profile_zone_t* zone; /**< Zone being measured */
+    uint32_t start;       /**< Timer value on entry */
+} profile_scope_t;
+
+/**
+ * @brief Enter a zone
+ * @param zone Zone to measure
+ * @return profile_scope_t Scope to pass to profile_end()
+ */
+profile_scope_t profile_begin(profile_zone_t* zone);
+
+/**
+ * @brief Leave a zone and accumulate its elapsed time
+ * @param scope Scope returned by profile_begin()
+ */
+void profile_end(profile_scope_t* scope);
+
+/**
+ * @brief Start the profiling timer
+ *
+ * Must be called once before the first zone is entered.
+ */
+void profile_init(void);
+
+/**
+ * @brief Print every zone, sorted by total time
+ */
+void profile_report(void);
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b)  PROFILE_CONCAT_(a, b)
+
+/**
+ * @brief Measure the rest of the enclosing block as the named zone
+ * @param name String literal labelling the zone
+ */
+#define PROFILE_ZONE(name)                                                                         \
+    static profile_zone_t PROFILE_CONCAT(profile_zone_, __LINE__) = {name, 0, 0, false, 0};        \
+    profile_scope_t PROFILE_CONCAT(profile_scope_, __LINE__)                                       \
+        __attribute__((cleanup(profile_end))) =                                                    \
+            profile_begin(&PROFILE_CONCAT(profile_zone_, __LINE__))
+
+#else
+
+#define PROFILE_ZONE(name) ((void)0)
+
+static inline void profile_init(void) {}
+static inline void profile_report(void) {}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
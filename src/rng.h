@@ -0,0 +1,65 @@
+/**
+ * @file rng.h
+ * @brief Small seeded pseudo-random number generator
+ *
+ * 32- and 64-bit xorshift generators: three shifts and XORs per value, no
+ * multiplication, and a full period of 2^n - 1 for any non-zero seed. Good
+ * enough for hash keys and test data, and identical on every platform so
+ * seeded output is reproducible.
+ *
+ * xorshift is linear over GF(2): every output is a fixed linear function of
+ * the state. Values wider than the state (e.g. two 32-bit outputs glued into
+ * a 64-bit key) therefore only span as many bits as the state holds, so wide
+ * hash keys must come from rng_next64().
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Advance the generator
+ * @param state Generator state (must be non-zero)
+ * @return uint32_t Next pseudo-random value
+ */
+static inline uint32_t rng_next(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+/**
+ * @brief Advance the 64-bit generator
+ * @param state Generator state (must be non-zero)
+ * @return uint64_t Next pseudo-random value
+ */
+static inline uint64_t rng_next64(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+/**
+ * @brief Draw a value in [0, bound)
+ * @param state Generator state
+ * @param bound Exclusive upper bound (must be non-zero)
+ * @return uint32_t Pseudo-random value below bound
+ *
+ * Uses the modulo, which is slightly biased for bounds that do not divide
+ * 2^32; negligible for the small bounds used here.
+ */
+static inline uint32_t rng_below(uint32_t* state, uint32_t bound) {
+    return rng_next(state) % bound;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,87 @@
+/**
+ * @file zobrist.c
+ * @brief Implementation of Zobrist hashing
+ */
+
+#include "zobrist.h"
+
+#include "rng.h"
+
+// ==========================
+//      Random Tables
+// ==========================
+
+zobrist_key_t zobrist_piece_keys[ZOBRIST_PIECE_KINDS][ZOBRIST_SQUARES];
+zobrist_key_t zobrist_castling_keys[CASTLE_ALL + 1];
+zobrist_key_t zobrist_en_passant_keys[8];
+zobrist_key_t zobrist_side_key;
+
+/** Fixed seed so keys are reproducible between runs and builds */
+#define ZOBRIST_SEED 0x2545F4914F6CDD1DULL
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Draw a random key of ZOBRIST_KEY_BITS width
+ * @param state Generator state
+ * @return zobrist_key_t Random key with all unused bits clear
+ *
+ * Every width masks the same 64-bit draw, so narrower keys are the low bits
+ * of wider ones. The draw needs 64 bits of state: keys built from a 32-bit
+ * xorshift would all lie in a 32-bit subspace whatever their width.
+ */
+static zobrist_key_t random_key(uint64_t* state) {
+    return (zobrist_key_t)(rng_next64(state) & ZOBRIST_KEY_MASK);
+}
+
+// ==========================
+//     Public Functions
+// ==========================
+
+void zobrist_init(void) {
+    uint64_t state = ZOBRIST_SEED;
+
+    for (uint8_t kind = 0; kind < ZOBRIST_PIECE_KINDS; ++kind) {
+        for (uint8_t square = 0; square < ZOBRIST_SQUARES; ++square) {
+            zobrist_piece_keys[kind][square] = random_key(&state);
+        }
+    }
+
+    /* Combined rights hash as the XOR of the individual rights */
+    zobrist_key_t rights[4];
+    for (uint8_t i = 0; i < 4; ++i) {
+        rights[i] = random_key(&state);
+    }
+    for (uint8_t mask = 0; mask <= CASTLE_ALL; ++mask) {
+        zobrist_key_t key = 0;
+        for (uint8_t i = 0; i < 4; ++i) {
+            if (mask & (1 << i)) {
+                key ^= rights[i];
+            }
+        }
+        zobrist_castling_keys[mask] = key;
+    }
+
+    for (uint8_t file = 0; file < 8; ++file) {
+        zobrist_en_passant_keys[file] = random_key(&state);
+    }
+
+    zobrist_side_key = random_key(&state);
+}
+
+zobrist_key_t zobrist_compute_key(const board_t* board) {
+    zobrist_key_t key = zobrist_state(board->side_to_move, board->castling_rights,
+                                      board->en_passant_square);
+
+    for (square_t square = 0; square < BOARD_SIZE(BOARD_LOGICAL); ++square) {
+        if (INVALID_SQUARE(square)) {
+            square += BOARD_WIDTH(BOARD_PHYSICAL) - 1;
+            continue;
+        }
+        key ^= zobrist_piece(board->squares[square], square);
+    }
+
+    return key;
+}
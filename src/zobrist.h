@@ -0,0 +1,98 @@
+/**
+ * @file zobrist.h
+ * @brief Zobrist hashing of chess positions
+ *
+ * A position key is the XOR of one random value per (piece, square) pair,
+ * plus values for the side to move, the castling rights and the en passant
+ * file. Because XOR is its own inverse, board_set_piece() keeps the key
+ * current by XORing the old and new piece values in and out.
+ *
+ * The key width is fixed at compile time by ZOBRIST_KEY_BITS (board.h). The
+ * random values are drawn from a fixed-seed generator, so keys are identical
+ * across builds of the same width.
+ */
+
+#pragma once
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of distinct colored piece types (6 white + 6 black) */
+#define ZOBRIST_PIECE_KINDS 12
+
+/** Number of playable squares */
+#define ZOBRIST_SQUARES 64
+
+/** Mask of the bits actually used by a key of ZOBRIST_KEY_BITS width */
+#if ZOBRIST_KEY_BITS == 64
+#define ZOBRIST_KEY_MASK (~(uint64_t)0)
+#else
+#define ZOBRIST_KEY_MASK (((uint64_t)1 << ZOBRIST_KEY_BITS) - 1)
+#endif
+
+/**
+ * @brief Zobrist random value tables
+ * @{
+ */
+extern zobrist_key_t zobrist_piece_keys[ZOBRIST_PIECE_KINDS][ZOBRIST_SQUARES];
+extern zobrist_key_t zobrist_castling_keys[CASTLE_ALL + 1];
+extern zobrist_key_t zobrist_en_passant_keys[8];
+extern zobrist_key_t zobrist_side_key;
+/** @} */
+
+/**
+ * @brief Fill the Zobrist tables
+ *
+ * Must be called once at startup, before any board is set up.
+ */
+void zobrist_init(void);
+
+/**
+ * @brief Get the key contribution of a piece on a square
+ * @param piece  Piece, or PIECE_NONE
+ * @param square Valid square in 0x88 format
+ * @return zobrist_key_t Random value for the pair, or 0 for PIECE_NONE
+ */
+static inline zobrist_key_t zobrist_piece(piece_t piece, square_t square) {
+    if (piece == PIECE_NONE) {
+        return 0;
+    }
+
+    uint8_t kind = GET_PIECE_TYPE(piece) - 1 + (IS_PIECE_COLOR(piece, PIECE_BLACK) ? 6 : 0);
+    return zobrist_piece_keys[kind][SQUARE_TO_INDEX(square)];
+}
+
+/**
+ * @brief Get the key contribution of the non-piece state
+ * @param side            Side to move
+ * @param castling_rights Castling rights
+ * @param en_passant      En passant target square, or NO_SQUARE
+ * @return zobrist_key_t XOR of the side, castling and en passant values
+ */
+static inline zobrist_key_t zobrist_state(side_t side, castling_rights_t castling_rights,
+                                          square_t en_passant) {
+    zobrist_key_t key = zobrist_castling_keys[castling_rights & CASTLE_ALL];
+    if (side == SIDE_BLACK) {
+        key ^= zobrist_side_key;
+    }
+    if (en_passant != NO_SQUARE) {
+        key ^= zobrist_en_passant_keys[SQUARE_TO_FILE(en_passant)];
+    }
+    return key;
+}
+
+/**
+ * @brief Compute a position key from scratch
+ * @param board Board to hash
+ * @return zobrist_key_t Key of the position
+ *
+ * Mainly for verification: board->key should always equal this value.
+ */
+zobrist_key_t zobrist_compute_key(const board_t* board);
+
+#ifdef __cplusplus
+}
+#endif
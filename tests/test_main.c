@@ -1,5 +1,12 @@
+#include "profile.h"
+#include "test_analysis.h"
 #include "test_board.h"
+#include "test_game.h"
+#include "test_legal.h"
 #include "test_move.h"
+#include "test_position_gen.h"
+#include "test_zobrist.h"
+#include "zobrist.h"
 
 #include <debug.h>
 
@@ -9,9 +16,19 @@ int main(void) {
     dbg_printf("\n          Running test suite ...          ");
     dbg_printf("\n==========================================\n");
 
+    profile_init();
+    zobrist_init();
+
     run_board_tests();
     run_fen_tests();
     run_move_tests();
+    run_legal_tests();
+    run_zobrist_tests();
+    run_game_tests();
+    run_analysis_tests();
+    run_position_gen_tests();
+
+    profile_report();
 
     dbg_printf("\n==========================================\n");
 
@@ -0,0 +1,80 @@
+#include "test_analysis.h"
+
+#include "analysis.h"
+#include "fen.h"
+#include "game.h"
+#include "legal.h"
+#include "move.h"
+
+#include <stddef.h>
+
+INIT_TEST_SUITE(ANALYSIS_TESTS);
+
+void run_analysis_tests(void) {
+    TEST_SUITE(ANALYSIS_TESTS);
+
+    TEST_CASE(ANALYSIS_TESTS, "Store and probe") {
+        analysis_clear();
+        move_t e4 = make_move(square_from_file_rank(4, 1), square_from_file_rank(4, 3));
+        move_t d4 = make_move(square_from_file_rank(3, 1), square_from_file_rank(3, 3));
+
+        ASSERT(ANALYSIS_TESTS, analysis_probe(1234) == NULL);
+
+        analysis_store(1234, e4, 25, 4);
+        const analysis_entry_t* entry = analysis_probe(1234);
+        ASSERT(ANALYSIS_TESTS, entry != NULL);
+        ASSERT(ANALYSIS_TESTS, entry->best_move == e4 && entry->score == 25 && entry->depth == 4);
+
+        /* Shallower results are ignored, deeper ones replace */
+        analysis_store(1234, d4, 10, 3);
+        ASSERT(ANALYSIS_TESTS, analysis_probe(1234)->best_move == e4);
+        analysis_store(1234, d4, 30, 6);
+        ASSERT(ANALYSIS_TESTS, analysis_probe(1234)->best_move == d4);
+        ASSERT(ANALYSIS_TESTS, analysis_probe(1234)->depth == 6);
+
+        /* Depth 0 means "no result" and is never stored */
+        analysis_store(99, e4, 0, 0);
+        ASSERT(ANALYSIS_TESTS, analysis_probe(99) == NULL);
+
+        analysis_clear();
+        ASSERT(ANALYSIS_TESTS, analysis_probe(1234) == NULL);
+    }
+    END_TEST_CASE(ANALYSIS_TESTS);
+
+    TEST_CASE(ANALYSIS_TESTS, "Bucket replacement") {
+        analysis_clear();
+
+        /* Three keys sharing one bucket: the shallowest entry is evicted */
+        zobrist_key_t a = 5;
+        zobrist_key_t b = 5 + ANALYSIS_BUCKETS;
+        zobrist_key_t c = 5 + 2 * ANALYSIS_BUCKETS;
+        analysis_store(a, 0, 0, 8);
+        analysis_store(b, 0, 0, 2);
+        analysis_store(c, 0, 0, 5);
+
+        ASSERT(ANALYSIS_TESTS, analysis_probe(a) != NULL);
+        ASSERT(ANALYSIS_TESTS, analysis_probe(b) == NULL);
+        ASSERT(ANALYSIS_TESTS, analysis_probe(c) != NULL);
+    }
+    END_TEST_CASE(ANALYSIS_TESTS);
+
+    TEST_CASE(ANALYSIS_TESTS, "Revisiting game positions") {
+        analysis_clear();
+        static game_t game;
+        game_init(&game, INITIAL_FEN);
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        legal_targets_from(&game.board, square_from_file_rank(4, 1), moves);
+        analysis_store(game.board.key, moves[0], 20, 7);
+
+        game_play_move(&game, moves[0]);
+        ASSERT(ANALYSIS_TESTS, analysis_probe(game.board.key) == NULL);
+
+        game_goto_ply(&game, 0);
+        const analysis_entry_t* entry = analysis_probe(game.board.key);
+        ASSERT(ANALYSIS_TESTS, entry != NULL && entry->depth == 7 && entry->best_move == moves[0]);
+    }
+    END_TEST_CASE(ANALYSIS_TESTS);
+
+    print_test_results(&ANALYSIS_TESTS);
+}
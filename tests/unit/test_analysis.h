@@ -0,0 +1,34 @@
+/**
+ * @file test_analysis.h
+ * @brief Unit tests for the analysis cache
+ *
+ * Provides test suites to verify that analysis results are found again by
+ * position key and that deeper results are kept over shallower ones.
+ */
+
+#pragma once
+
+#include "test_framework.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Test suite for the analysis cache */
+extern TestSuite ANALYSIS_TESTS;
+
+/**
+ * @brief Execute all analysis cache unit tests
+ *
+ * Runs tests covering:
+ *
+ * - Storing and probing results by position key
+ * - Deeper results replacing shallower ones, never the reverse
+ * - Eviction of the shallower entry in a full bucket
+ * - Results surviving navigation away from and back to a position
+ */
+void run_analysis_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -9,6 +9,32 @@
 INIT_TEST_SUITE(BOARD_TESTS);
 INIT_TEST_SUITE(FEN_TESTS);
 
+/**
+ * @brief Check the incremental ray table against a from-scratch walk
+ * @param board Board to verify
+ * @return true if every ray end matches
+ */
+static bool ray_ends_match(const board_t* board) {
+    for (square_t sq = 0; sq < BOARD_SIZE(BOARD_LOGICAL); ++sq) {
+        if (!is_valid_square(sq)) {
+            continue;
+        }
+        for (uint8_t dir = 0; dir < DIR_COUNT; ++dir) {
+            square_t end = sq;
+            while (is_valid_square(end + DIRECTION_OFFSETS[dir])) {
+                end += DIRECTION_OFFSETS[dir];
+                if (!board_is_empty(board, end)) {
+                    break;
+                }
+            }
+            if (board_ray_end(board, sq, dir) != end) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void run_board_tests(void) {
     TEST_SUITE(BOARD_TESTS);
 
@@ -87,6 +113,37 @@ void run_board_tests(void) {
     }
     END_TEST_CASE(BOARD_TESTS);
 
+    TEST_CASE(BOARD_TESTS, "Ray end tracking") {
+        board_t board;
+        board_init(&board);
+        ASSERT(BOARD_TESTS, ray_ends_match(&board));
+
+        square_t a1 = FILE_RANK_TO_SQUARE(0, 0);
+        square_t d4 = FILE_RANK_TO_SQUARE(3, 3);
+        square_t h8 = FILE_RANK_TO_SQUARE(7, 7);
+        ASSERT(BOARD_TESTS, board_ray_end(&board, a1, DIR_NORTH_EAST) == h8);
+        ASSERT(BOARD_TESTS, board_ray_end(&board, a1, DIR_SOUTH) == a1);
+
+        /* Placing a piece shortens rays through it, removing it restores them */
+        board_set_piece(&board, d4, MAKE_PIECE(PIECE_BLACK, PIECE_ROOK));
+        ASSERT(BOARD_TESTS, board_ray_end(&board, a1, DIR_NORTH_EAST) == d4);
+        ASSERT(BOARD_TESTS, ray_ends_match(&board));
+
+        board_set_piece(&board, d4, MAKE_PIECE(PIECE_WHITE, PIECE_QUEEN));
+        ASSERT(BOARD_TESTS, ray_ends_match(&board));
+
+        board_set_piece(&board, d4, PIECE_NONE);
+        ASSERT(BOARD_TESTS, board_ray_end(&board, a1, DIR_NORTH_EAST) == h8);
+        ASSERT(BOARD_TESTS, ray_ends_match(&board));
+
+        board_reset(&board);
+        ASSERT(BOARD_TESTS, ray_ends_match(&board));
+        board_set_piece(&board, FILE_RANK_TO_SQUARE(4, 1), PIECE_NONE);
+        board_set_piece(&board, FILE_RANK_TO_SQUARE(4, 3), MAKE_PIECE(PIECE_WHITE, PIECE_PAWN));
+        ASSERT(BOARD_TESTS, ray_ends_match(&board));
+    }
+    END_TEST_CASE(BOARD_TESTS);
+
     print_test_results(&BOARD_TESTS);
 }
 
@@ -124,6 +181,21 @@ void run_fen_tests(void) {
     }
     END_TEST_CASE(FEN_TESTS);
 
+    TEST_CASE(FEN_TESTS, "Longest FEN fits FEN_MAX_LEN") {
+        board_t board;
+        board_init(&board);
+
+        /* Every rank alternates pieces and single empty squares */
+        const char* fen = "1k1n1b1r/1p1p1p1p/p1p1p1p1/1n1b1q1r/R1N1P1Q1/1P1P1P1P/P1P1P1P1/1K1N1B1R "
+                          "b KQkq e3 65535 65535";
+        ASSERT(FEN_TESTS, board_set_fen(&board, fen));
+
+        char output_fen[FEN_MAX_LEN];
+        board_get_fen(&board, output_fen, sizeof(output_fen));
+        ASSERT(FEN_TESTS, strcmp(fen, output_fen) == 0);
+    }
+    END_TEST_CASE(FEN_TESTS);
+
     TEST_CASE(FEN_TESTS, "Complex position parsing") {
         board_t board;
         board_init(&board);
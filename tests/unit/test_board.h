@@ -36,6 +36,7 @@ extern TestSuite FEN_TESTS;
  * - Piece conversion between ASCII and internal representation
  * - Setting and getting pieces on the board
  * - King position tracking
+ * - Incremental nearest-blocker (ray end) table
  */
 void run_board_tests(void);
 
@@ -47,6 +48,7 @@ void run_board_tests(void);
  *
  * - Parsing standard starting position
  * - Generating FEN strings from board state
+ * - Fitting the longest possible FEN in FEN_MAX_LEN
  * - Handling complex positions with en passant
  * - Validating incorrect/malformed FEN strings
  * - Preserving special state (castling rights, move counts)
@@ -0,0 +1,212 @@
+#include "test_game.h"
+
+#include "board.h"
+#include "fen.h"
+#include "game.h"
+#include "legal.h"
+#include "makemove.h"
+#include "move.h"
+#include "zobrist.h"
+
+#include <string.h>
+
+INIT_TEST_SUITE(GAME_TESTS);
+
+/**
+ * @brief Compare everything that defines a position, including derived tables
+ * @param a First board
+ * @param b Second board
+ * @return true if both boards describe the same position
+ */
+static bool same_position(const board_t* a, const board_t* b) {
+    return memcmp(a->squares, b->squares, sizeof(a->squares)) == 0 &&
+           memcmp(a->ray_end, b->ray_end, sizeof(a->ray_end)) == 0 &&
+           a->side_to_move == b->side_to_move && a->castling_rights == b->castling_rights &&
+           a->en_passant_square == b->en_passant_square &&
+           a->halfmove_clock == b->halfmove_clock && a->fullmove_number == b->fullmove_number &&
+           a->king_square[SIDE_WHITE] == b->king_square[SIDE_WHITE] &&
+           a->king_square[SIDE_BLACK] == b->king_square[SIDE_BLACK] && a->key == b->key;
+}
+
+/**
+ * @brief Check a board against the same position parsed from its own FEN
+ * @param board Board reached by making moves
+ * @return true if the incremental state matches a fresh setup
+ */
+static bool matches_fresh_setup(const board_t* board) {
+    static board_t fresh;
+    char fen[FEN_MAX_LEN];
+    board_init(&fresh);
+    board_get_fen(board, fen, sizeof(fen));
+    return board_set_fen(&fresh, fen) && same_position(board, &fresh) &&
+           board->check_info.num_checkers == fresh.check_info.num_checkers &&
+           board->check_info.num_pinned == fresh.check_info.num_pinned;
+}
+
+/**
+ * @brief Collect every legal move of the side to move
+ * @param board Board to generate for
+ * @param moves Buffer of at least LEGAL_MOVES_MAX moves
+ * @return uint8_t Number of moves
+ */
+static uint8_t all_legal_moves(const board_t* board, move_t* moves) {
+    uint8_t count = 0;
+    for (square_t sq = 0; sq < BOARD_SIZE(BOARD_LOGICAL); ++sq) {
+        if (is_valid_square(sq)) {
+            count += legal_targets_from(board, sq, moves + count);
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Find the legal move between two squares
+ * @param board Board to search
+ * @param from  Origin in algebraic notation (e.g. "e2")
+ * @param to    Destination in algebraic notation
+ * @return move_t The move (first promotion choice if several), or 0
+ */
+static move_t find_move(const board_t* board, const char* from, const char* to) {
+    move_t moves[LEGAL_TARGETS_MAX];
+    square_t origin = square_from_file_rank(from[0] - 'a', from[1] - '1');
+    square_t target = square_from_file_rank(to[0] - 'a', to[1] - '1');
+    uint8_t count = legal_targets_from(board, origin, moves);
+    for (uint8_t i = 0; i < count; ++i) {
+        if (get_to_square(moves[i]) == target) {
+            return moves[i];
+        }
+    }
+    return 0;
+}
+
+void run_game_tests(void) {
+    TEST_SUITE(GAME_TESTS);
+
+    TEST_CASE(GAME_TESTS, "Make and unmake round trip") {
+        static const char* const FENS[] = {
+            INITIAL_FEN,
+            "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+            "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+            "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+            "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 b - - 3 40",
+        };
+
+        static move_t moves[LEGAL_MOVES_MAX];
+        static board_t board;
+        static board_t before;
+        board_init(&board);
+
+        bool restored = true;
+        bool consistent = true;
+        for (uint8_t f = 0; f < sizeof(FENS) / sizeof(FENS[0]); ++f) {
+            board_set_fen(&board, FENS[f]);
+            before = board;
+
+            uint8_t count = all_legal_moves(&board, moves);
+            for (uint8_t i = 0; i < count; ++i) {
+                undo_t undo;
+                board_make_move(&board, moves[i], &undo);
+                consistent &= matches_fresh_setup(&board);
+                consistent &= board.key == zobrist_compute_key(&board);
+
+                board_unmake_move(&board, &undo);
+                restored &= same_position(&board, &before);
+            }
+        }
+        ASSERT(GAME_TESTS, consistent);
+        ASSERT(GAME_TESTS, restored);
+    }
+    END_TEST_CASE(GAME_TESTS);
+
+    TEST_CASE(GAME_TESTS, "Special move side effects") {
+        board_t board;
+        undo_t undo;
+        board_init(&board);
+
+        /* Kingside castling moves the rook and drops both white rights */
+        board_set_fen(&board, "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 5 10");
+        board_make_move(&board, find_move(&board, "e1", "g1"), &undo);
+        ASSERT(GAME_TESTS, board_get_piece(&board, square_from_file_rank(5, 0)) ==
+                               MAKE_PIECE(PIECE_WHITE, PIECE_ROOK));
+        ASSERT(GAME_TESTS, board_is_empty(&board, square_from_file_rank(7, 0)));
+        ASSERT(GAME_TESTS, board.castling_rights == (CASTLE_BK | CASTLE_BQ));
+        ASSERT(GAME_TESTS, board.halfmove_clock == 6);
+
+        /* Capturing a rook on its corner removes that side's right */
+        board_set_fen(&board, "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1");
+        board_make_move(&board, find_move(&board, "a1", "a8"), &undo);
+        ASSERT(GAME_TESTS, board.castling_rights == (CASTLE_WK | CASTLE_BK));
+        ASSERT(GAME_TESTS, board.halfmove_clock == 0);
+
+        /* En passant removes the passed pawn */
+        board_set_fen(&board, "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1");
+        board_make_move(&board, find_move(&board, "e5", "d6"), &undo);
+        ASSERT(GAME_TESTS, board_is_empty(&board, square_from_file_rank(3, 4)));
+        ASSERT(GAME_TESTS, board.en_passant_square == NO_SQUARE);
+
+        /* Double pushes set the en passant square, black moves bump the move number */
+        board_set_fen(&board, INITIAL_FEN);
+        board_make_move(&board, find_move(&board, "e2", "e4"), &undo);
+        ASSERT(GAME_TESTS, board.en_passant_square == square_from_file_rank(4, 2));
+        board_make_move(&board, find_move(&board, "c7", "c5"), &undo);
+        ASSERT(GAME_TESTS, board.fullmove_number == 2);
+
+        /* Promotion replaces the pawn, unmake brings it back */
+        board_set_fen(&board, "1n2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+        board_make_move(&board, find_move(&board, "a7", "b8"), &undo);
+        ASSERT(GAME_TESTS, board_get_piece(&board, square_from_file_rank(1, 7)) ==
+                               MAKE_PIECE(PIECE_WHITE, PIECE_QUEEN));
+        board_unmake_move(&board, &undo);
+        ASSERT(GAME_TESTS, board_get_piece(&board, square_from_file_rank(0, 6)) ==
+                               MAKE_PIECE(PIECE_WHITE, PIECE_PAWN));
+        ASSERT(GAME_TESTS, board_get_piece(&board, square_from_file_rank(1, 7)) ==
+                               MAKE_PIECE(PIECE_BLACK, PIECE_KNIGHT));
+    }
+    END_TEST_CASE(GAME_TESTS);
+
+    TEST_CASE(GAME_TESTS, "Game navigation") {
+        static const char* const LINE[][2] = {
+            {"e2", "e4"}, {"e7", "e5"}, {"g1", "f3"}, {"b8", "c6"}, {"f1", "b5"}, {"a7", "a6"},
+        };
+        static game_t game;
+        game_init(&game, INITIAL_FEN);
+        board_t start = game.board;
+
+        for (uint8_t i = 0; i < sizeof(LINE) / sizeof(LINE[0]); ++i) {
+            game_play_move(&game, find_move(&game.board, LINE[i][0], LINE[i][1]));
+        }
+        board_t end = game.board;
+        ASSERT(GAME_TESTS, game.ply == 6 && game.length == 6);
+
+        ASSERT(GAME_TESTS, game_goto_ply(&game, 0));
+        ASSERT(GAME_TESTS, same_position(&game.board, &start));
+        ASSERT(GAME_TESTS, !game_undo(&game));
+
+        ASSERT(GAME_TESTS, game_goto_ply(&game, 6));
+        ASSERT(GAME_TESTS, same_position(&game.board, &end));
+        zobrist_key_t key = 0;
+        ASSERT(GAME_TESTS, game_key_at(&game, 6, &key) && key == end.key);
+        ASSERT(GAME_TESTS, !game_redo(&game));
+        ASSERT(GAME_TESTS, !game_goto_ply(&game, 7));
+
+        ASSERT(GAME_TESTS, game_goto_ply(&game, 2));
+        ASSERT(GAME_TESTS, game_key_at(&game, 0, &key) && key == start.key);
+        ASSERT(GAME_TESTS, game_key_at(&game, 2, &key) && key == game.board.key);
+
+        /* The final position's key is only known while it is current */
+        key = 1;
+        ASSERT(GAME_TESTS, !game_key_at(&game, 6, &key) && key == 1);
+        ASSERT(GAME_TESTS, !game_key_at(&game, 7, &key) && key == 1);
+        ASSERT(GAME_TESTS, game_undo(&game) && game_redo(&game) && game.ply == 2);
+
+        /* Replaying the recorded move keeps the line, a new move replaces it */
+        game_play_move(&game, find_move(&game.board, "g1", "f3"));
+        ASSERT(GAME_TESTS, game.ply == 3 && game.length == 6);
+        game_play_move(&game, find_move(&game.board, "g8", "f6"));
+        ASSERT(GAME_TESTS, game.ply == 4 && game.length == 4);
+        ASSERT(GAME_TESTS, matches_fresh_setup(&game.board));
+    }
+    END_TEST_CASE(GAME_TESTS);
+
+    print_test_results(&GAME_TESTS);
+}
@@ -0,0 +1,36 @@
+/**
+ * @file test_game.h
+ * @brief Unit tests for make/unmake and the game record
+ *
+ * Provides test suites to verify that making and unmaking moves restores
+ * the exact position, that special moves update the board and state
+ * correctly, and that game navigation moves between plies incrementally.
+ */
+
+#pragma once
+
+#include "test_framework.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Test suite for make/unmake and the game record */
+extern TestSuite GAME_TESTS;
+
+/**
+ * @brief Execute all game-related unit tests
+ *
+ * Runs tests covering:
+ *
+ * - Make/unmake round trips over every legal move of several positions
+ * - Incremental state matching a freshly parsed FEN after each move
+ * - Castling, en passant and promotion side effects
+ * - Undo, redo and jumping to any ply
+ * - Replacing and preserving the redo line
+ */
+void run_game_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,292 @@
+#include "test_legal.h"
+
+#include "attack.h"
+#include "board.h"
+#include "fen.h"
+#include "legal.h"
+#include "move.h"
+
+INIT_TEST_SUITE(LEGAL_TESTS);
+
+/**
+ * @brief Check if a move list contains a move to the given square
+ * @param moves Move list
+ * @param count Number of moves in the list
+ * @param to    Destination square to look for
+ * @return true if any move lands on the square
+ */
+static bool has_target(const move_t* moves, uint8_t count, square_t to) {
+    for (uint8_t i = 0; i < count; ++i) {
+        if (get_to_square(moves[i]) == to) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void run_legal_tests(void) {
+    TEST_SUITE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Square attack detection") {
+        board_t board;
+        board_init(&board);
+        board_reset(&board);
+
+        ASSERT(LEGAL_TESTS, is_square_attacked(&board, square_from_file_rank(4, 2), SIDE_WHITE));
+        ASSERT(LEGAL_TESTS, is_square_attacked(&board, square_from_file_rank(5, 2), SIDE_WHITE));
+        ASSERT(LEGAL_TESTS, !is_square_attacked(&board, square_from_file_rank(4, 3), SIDE_WHITE));
+        ASSERT(LEGAL_TESTS, is_square_attacked(&board, square_from_file_rank(4, 5), SIDE_BLACK));
+        ASSERT(LEGAL_TESTS, !is_square_attacked(&board, square_from_file_rank(4, 5), SIDE_WHITE));
+
+        /* Rook on e4 sees along the file until blocked */
+        board_set_fen(&board, "4k3/8/8/8/4r3/8/4P3/4K3 w - - 0 1");
+        ASSERT(LEGAL_TESTS, is_square_attacked(&board, square_from_file_rank(4, 1), SIDE_BLACK));
+        ASSERT(LEGAL_TESTS, !is_square_attacked(&board, square_from_file_rank(4, 0), SIDE_BLACK));
+        ASSERT(LEGAL_TESTS, is_square_attacked_after(&board, square_from_file_rank(4, 0),
+                                                     SIDE_BLACK, square_from_file_rank(4, 1),
+                                                     NO_SQUARE, square_from_file_rank(3, 2)));
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Leaper target tables") {
+        ASSERT(LEGAL_TESTS, KNIGHT_TARGETS[square_from_file_rank(0, 0)].count == 2);
+        ASSERT(LEGAL_TESTS, KNIGHT_TARGETS[square_from_file_rank(3, 3)].count == 8);
+        ASSERT(LEGAL_TESTS, KING_TARGETS[square_from_file_rank(7, 7)].count == 3);
+        ASSERT(LEGAL_TESTS, KING_TARGETS[square_from_file_rank(4, 0)].count == 5);
+        ASSERT(LEGAL_TESTS, KNIGHT_TARGETS[0x08].count == 0);
+
+        /* Every listed target must be on the board and a king step away */
+        for (square_t sq = 0; sq < BOARD_SIZE(BOARD_LOGICAL); ++sq) {
+            const target_list_t* list = &KING_TARGETS[sq];
+            for (uint8_t i = 0; i < list->count; ++i) {
+                square_t to = list->targets[i];
+                int8_t file_diff = square_to_file(to) - square_to_file(sq);
+                int8_t rank_diff = square_to_rank(to) - square_to_rank(sq);
+                ASSERT(LEGAL_TESTS, is_valid_square(to));
+                ASSERT(LEGAL_TESTS, file_diff >= -1 && file_diff <= 1);
+                ASSERT(LEGAL_TESTS, rank_diff >= -1 && rank_diff <= 1);
+            }
+        }
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Initial position targets") {
+        board_t board;
+        board_init(&board);
+        board_reset(&board);
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        uint8_t count = legal_targets_from(&board, square_from_file_rank(4, 1), moves);  // e2
+        ASSERT(LEGAL_TESTS, count == 2);
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(4, 2)));
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(4, 3)));
+
+        count = legal_targets_from(&board, square_from_file_rank(6, 0), moves);  // g1
+        ASSERT(LEGAL_TESTS, count == 2);
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(5, 2)));
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(7, 2)));
+
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 0), moves) == 0);
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 6), moves) == 0);
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 3), moves) == 0);
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, NO_SQUARE, moves) == 0);
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Pinned piece") {
+        board_t board;
+        board_init(&board);
+        board_set_fen(&board, "4k3/4r3/8/8/8/8/4B3/4K3 w - - 0 1");
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 1), moves) == 0);
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 0), moves) == 4);
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Check evasion") {
+        board_t board;
+        board_init(&board);
+        board_set_fen(&board, "4k3/8/8/8/4r3/8/8/R3K2R w KQ - 0 1");
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        uint8_t count = legal_targets_from(&board, square_from_file_rank(4, 0), moves);  // e1
+        ASSERT(LEGAL_TESTS, count == 4);
+        ASSERT(LEGAL_TESTS, !has_target(moves, count, square_from_file_rank(4, 1)));
+        ASSERT(LEGAL_TESTS, !has_target(moves, count, square_from_file_rank(6, 0)));
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(0, 0), moves) == 0);
+
+        /* Interposing is the only other way out */
+        board_set_fen(&board, "4k3/8/8/8/4r3/8/8/3RK3 w - - 0 1");
+        count = legal_targets_from(&board, square_from_file_rank(3, 0), moves);  // d1
+        ASSERT(LEGAL_TESTS, count == 0);
+        board_set_fen(&board, "4k3/8/8/8/4r3/8/8/R3K3 w - - 0 1");
+        count = legal_targets_from(&board, square_from_file_rank(0, 0), moves);  // a1
+        ASSERT(LEGAL_TESTS, count == 0);
+        board_set_fen(&board, "4k3/8/8/8/4r3/8/R7/4K3 w - - 0 1");
+        count = legal_targets_from(&board, square_from_file_rank(0, 1), moves);  // a2
+        ASSERT(LEGAL_TESTS, count == 1);
+        ASSERT(LEGAL_TESTS, get_to_square(moves[0]) == square_from_file_rank(4, 1));
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Castling legality") {
+        board_t board;
+        board_init(&board);
+        board_set_fen(&board, "4k3/8/8/8/8/8/8/R3K2R w KQ - 0 1");
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        uint8_t count = legal_targets_from(&board, square_from_file_rank(4, 0), moves);
+        ASSERT(LEGAL_TESTS, count == 7);
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(6, 0)));
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(2, 0)));
+
+        /* Rook on f3 covers f1, so only the queenside castle remains */
+        board_set_fen(&board, "4k3/8/8/8/8/5r2/8/R3K2R w KQ - 0 1");
+        count = legal_targets_from(&board, square_from_file_rank(4, 0), moves);
+        ASSERT(LEGAL_TESTS, count == 4);
+        ASSERT(LEGAL_TESTS, !has_target(moves, count, square_from_file_rank(6, 0)));
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(2, 0)));
+        for (uint8_t i = 0; i < count; ++i) {
+            if (get_to_square(moves[i]) == square_from_file_rank(2, 0)) {
+                ASSERT(LEGAL_TESTS, get_special_type(moves[i]) == SPECIAL_CASTLE_QUEEN);
+            }
+        }
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "En passant legality") {
+        board_t board;
+        board_init(&board);
+        board_set_fen(&board, "4k3/8/8/K2pP3/8/8/8/8 w - d6 0 1");
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        uint8_t count = legal_targets_from(&board, square_from_file_rank(4, 4), moves);  // e5
+        ASSERT(LEGAL_TESTS, count == 2);
+        ASSERT(LEGAL_TESTS, has_target(moves, count, square_from_file_rank(3, 5)));
+
+        /* Both pawns leave the fifth rank, exposing the king to the rook */
+        board_set_fen(&board, "4k3/8/8/K2pP2r/8/8/8/8 w - d6 0 1");
+        count = legal_targets_from(&board, square_from_file_rank(4, 4), moves);
+        ASSERT(LEGAL_TESTS, count == 1);
+        ASSERT(LEGAL_TESTS, !has_target(moves, count, square_from_file_rank(3, 5)));
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Promotion expansion") {
+        board_t board;
+        board_init(&board);
+        board_set_fen(&board, "1r2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        uint8_t count = legal_targets_from(&board, square_from_file_rank(0, 6), moves);  // a7
+        ASSERT(LEGAL_TESTS, count == 8);
+        for (uint8_t i = 0; i < count; ++i) {
+            ASSERT(LEGAL_TESTS, is_promotion(moves[i]));
+            if (get_to_square(moves[i]) == square_from_file_rank(1, 7)) {
+                ASSERT(LEGAL_TESTS, get_capture_type(moves[i]) == PIECE_ROOK);
+            }
+        }
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Cache invalidation") {
+        board_t board;
+        board_init(&board);
+        board_reset(&board);
+
+        move_t moves[LEGAL_TARGETS_MAX];
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 1), moves) == 2);
+
+        /* Dropping a black pawn on e3 blocks e2 and gives d2 a capture */
+        board_set_piece(&board, square_from_file_rank(4, 2), MAKE_PIECE(PIECE_BLACK, PIECE_PAWN));
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 1), moves) == 0);
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(3, 1), moves) == 3);
+
+        /* A second board at a different address never shares the cache */
+        board_t other;
+        board_init(&other);
+        board_reset(&other);
+        ASSERT(LEGAL_TESTS, legal_targets_from(&other, square_from_file_rank(4, 1), moves) == 2);
+        ASSERT(LEGAL_TESTS, legal_targets_from(&board, square_from_file_rank(4, 1), moves) == 0);
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Legal move existence") {
+        board_t board;
+        board_init(&board);
+        board_reset(&board);
+        ASSERT(LEGAL_TESTS, has_legal_move(&board));
+        ASSERT(LEGAL_TESTS, !is_in_check(&board));
+
+        /* Only the rook can move; the king is boxed in by the queen */
+        board_set_fen(&board, "k7/2Q5/8/8/8/8/4K3/7r b - - 0 1");
+        ASSERT(LEGAL_TESTS, has_legal_move(&board));
+        ASSERT(LEGAL_TESTS, !is_stalemate(&board));
+
+        /* Double check: the knight could capture one checker, but only the king may move */
+        board_set_fen(&board, "4k3/8/3N4/8/8/8/4R3/4K3 b - - 0 1");
+        ASSERT(LEGAL_TESTS, is_in_check(&board));
+        ASSERT(LEGAL_TESTS, has_legal_move(&board));
+        board_set_fen(&board, "3rkr2/3p1p2/3N4/8/8/8/4R3/4K3 b - - 0 1");
+        ASSERT(LEGAL_TESTS, !has_legal_move(&board));
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Checkmate and stalemate") {
+        board_t board;
+        board_init(&board);
+
+        /* Fool's mate */
+        board_set_fen(&board, "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3");
+        ASSERT(LEGAL_TESTS, is_in_check(&board));
+        ASSERT(LEGAL_TESTS, is_checkmate(&board));
+        ASSERT(LEGAL_TESTS, !is_stalemate(&board));
+
+        /* Same pattern with a knight on f2 shielding the king */
+        board_set_fen(&board, "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPPN1P/RNBQKB1R w KQkq - 1 3");
+        ASSERT(LEGAL_TESTS, !is_checkmate(&board));
+
+        board_set_fen(&board, "7k/5Q2/6K1/8/8/8/8/8 b - - 0 1");
+        ASSERT(LEGAL_TESTS, !is_in_check(&board));
+        ASSERT(LEGAL_TESTS, is_stalemate(&board));
+        ASSERT(LEGAL_TESTS, !is_checkmate(&board));
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    TEST_CASE(LEGAL_TESTS, "Cached check info") {
+        board_t board;
+        board_init(&board);
+
+        /* Bishop b4 checks e1, rook e8 pins the e2 knight */
+        board_set_fen(&board, "4r1k1/8/8/8/1b6/8/4N3/4K3 w - - 0 1");
+        const check_info_t* info = &board.check_info;
+        ASSERT(LEGAL_TESTS, info->revision == board.revision);
+        ASSERT(LEGAL_TESTS, info->num_checkers == 1);
+        ASSERT(LEGAL_TESTS, info->checkers[0] == square_from_file_rank(1, 3));
+        ASSERT(LEGAL_TESTS, info->num_evasions == 3);
+        ASSERT(LEGAL_TESTS, info->num_pinned == 1);
+        ASSERT(LEGAL_TESTS, info->pinned[0] == square_from_file_rank(4, 1));
+
+        check_info_t scratch;
+        ASSERT(LEGAL_TESTS, board_check_info(&board, &scratch) == info);
+
+        /* Editing the board makes the cached copy stale */
+        board_set_piece(&board, square_from_file_rank(1, 3), PIECE_NONE);
+        info = board_check_info(&board, &scratch);
+        ASSERT(LEGAL_TESTS, info == &scratch);
+        ASSERT(LEGAL_TESTS, info->num_checkers == 0);
+        ASSERT(LEGAL_TESTS, info->num_pinned == 1);
+
+        board_update_check_info(&board);
+        ASSERT(LEGAL_TESTS, board_check_info(&board, &scratch) == &board.check_info);
+
+        /* An impossible triple check is counted in full */
+        board_set_fen(&board, "6R1/3pP1nP/5P2/1n1p1prK/p4b2/Qbp3p1/p2PBkpr/2R3q1 w - - 0 1");
+        ASSERT(LEGAL_TESTS, board.check_info.num_checkers == 3);
+        ASSERT(LEGAL_TESTS, board.check_info.num_evasions == 0);
+    }
+    END_TEST_CASE(LEGAL_TESTS);
+
+    print_test_results(&LEGAL_TESTS);
+}
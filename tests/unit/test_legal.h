@@ -0,0 +1,43 @@
+/**
+ * @file test_legal.h
+ * @brief Unit tests for attack detection and legal move queries
+ *
+ * Provides test suites to verify that square attacks are detected from every
+ * piece type and that per-square legal move queries respect check, pins,
+ * castling restrictions, en passant and promotion rules.
+ */
+
+#pragma once
+
+#include "test_framework.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Test suite for attack detection and legal move queries */
+extern TestSuite LEGAL_TESTS;
+
+/**
+ * @brief Execute all legality-related unit tests
+ *
+ * Runs tests covering:
+ *
+ * - Square attack detection for pawns, knights and sliders
+ * - Precomputed knight and king target tables
+ * - Legal targets in the initial position
+ * - Absolutely pinned pieces
+ * - Check evasions
+ * - Castling through and out of attacked squares
+ * - En passant exposing the king along a rank
+ * - Promotion expansion
+ * - Cache invalidation after board changes
+ * - Legal move existence, including double check
+ * - Checkmate and stalemate detection
+ * - Check and pin info cached by board_set_fen()
+ */
+void run_legal_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -299,5 +299,36 @@ void run_move_tests(void) {
     }
     END_TEST_CASE(MOVE_TESTS);
 
+    TEST_CASE(MOVE_TESTS, "Raw value ordering") {
+        square_t e4 = square_from_file_rank(4, 3);
+        square_t d5 = square_from_file_rank(3, 4);
+        square_t a7 = square_from_file_rank(0, 6);
+        square_t a8 = square_from_file_rank(0, 7);
+        square_t b8 = square_from_file_rank(1, 7);
+
+        /* Priority dominates every other field */
+        move_t quiet = make_move(a7, a8);
+        move_t hash = set_priority(make_move(e4, d5), PRIORITY_HASH);
+        move_t killer = set_priority(make_move(e4, d5), PRIORITY_KILLER);
+        ASSERT(MOVE_TESTS, MOVE_ORDERS_BEFORE(hash, make_capture(e4, d5, PIECE_QUEEN)));
+        ASSERT(MOVE_TESTS, MOVE_ORDERS_BEFORE(killer, make_promotion(a7, a8, PIECE_QUEEN)));
+        ASSERT(MOVE_TESTS, MOVE_ORDERS_BEFORE(make_capture(e4, d5, PIECE_PAWN), killer));
+
+        /* Among captures, the more valuable victim comes first */
+        move_t takes_queen = make_capture(e4, d5, PIECE_QUEEN);
+        move_t takes_rook = make_capture(e4, d5, PIECE_ROOK);
+        ASSERT(MOVE_TESTS, MOVE_ORDERS_BEFORE(takes_queen, takes_rook));
+        ASSERT(MOVE_TESTS, MOVE_ORDERS_BEFORE(make_capture(a7, b8, PIECE_KNIGHT),
+                                              make_special(e4, d5, SPECIAL_EN_PASSANT)));
+
+        /* Then the stronger promotion piece */
+        move_t to_queen = make_capture_promotion(a7, b8, PIECE_ROOK, PIECE_QUEEN);
+        move_t to_knight = make_capture_promotion(a7, b8, PIECE_ROOK, PIECE_KNIGHT);
+        ASSERT(MOVE_TESTS, MOVE_ORDERS_BEFORE(to_queen, to_knight));
+        ASSERT(MOVE_TESTS, MOVE_ORDERS_BEFORE(make_promotion(a7, a8, PIECE_KNIGHT), quiet));
+        ASSERT(MOVE_TESTS, !MOVE_ORDERS_BEFORE(quiet, quiet));
+    }
+    END_TEST_CASE(MOVE_TESTS);
+
     print_test_results(&MOVE_TESTS);
 }
\ No newline at end of file
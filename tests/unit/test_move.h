@@ -43,6 +43,7 @@ extern TestSuite MOVE_TESTS;
  * - All promotion piece combinations
  * - Special move interaction with captures
  * - Priority preservation across move types
+ * - Raw value ordering by priority, victim and promotion
  * - Move string edge cases and validation
  * - Combined attribute verification
  */
@@ -0,0 +1,156 @@
+#include "test_position_gen.h"
+
+#include "attack.h"
+#include "board.h"
+#include "fen.h"
+#include "position_gen.h"
+#include "zobrist.h"
+
+#include <string.h>
+
+INIT_TEST_SUITE(POSITION_GEN_TESTS);
+
+/**
+ * @brief Tally of the FENs a corpus emitted
+ */
+typedef struct {
+    uint16_t emitted;                            /**< FENs received */
+    uint16_t empty;                              /**< Empty FENs received */
+    uint8_t levels[POSITION_GEN_MAX_PIECES + 1]; /**< FENs per piece count */
+} corpus_stats_t;
+
+/** Corpus callback filling a corpus_stats_t */
+static void count_fen(const char* fen, void* context) {
+    corpus_stats_t* stats = context;
+    stats->emitted++;
+    stats->empty += fen[0] == '\0';
+
+    uint8_t pieces = 0;
+    for (; *fen && *fen != ' '; ++fen) {
+        pieces += (*fen >= 'A' && *fen <= 'Z') || (*fen >= 'a' && *fen <= 'z');
+    }
+    if (pieces <= POSITION_GEN_MAX_PIECES) {
+        stats->levels[pieces]++;
+    }
+}
+
+/**
+ * @brief Check that a corpus covered a range of piece counts evenly
+ * @param stats      Tally of the corpus
+ * @param min_pieces Fewest pieces expected
+ * @param max_pieces Most pieces expected
+ * @param per_level  FENs expected at each piece count in range
+ * @return true if every count in range got per_level FENs and no other count got any
+ */
+static bool levels_match(const corpus_stats_t* stats, uint8_t min_pieces, uint8_t max_pieces,
+                         uint8_t per_level) {
+    for (uint8_t pieces = 0; pieces <= POSITION_GEN_MAX_PIECES; ++pieces) {
+        bool in_range = pieces >= min_pieces && pieces <= max_pieces;
+        if (stats->levels[pieces] != (in_range ? per_level : 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void run_position_gen_tests(void) {
+    TEST_SUITE(POSITION_GEN_TESTS);
+
+    TEST_CASE(POSITION_GEN_TESTS, "Random legal positions") {
+        board_t board;
+        board_t parsed;
+        board_init(&board);
+        board_init(&parsed);
+
+        uint32_t seed = 12345;
+        bool legal = true;
+        bool counted = true;
+        bool round_trip = true;
+        for (uint8_t n = 0; n < 60; ++n) {
+            uint8_t num_pieces = POSITION_GEN_MIN_PIECES + n % 31;
+            position_gen_random(&board, &seed, num_pieces);
+
+            uint8_t count = 0;
+            for (square_t sq = 0; sq < BOARD_SIZE(BOARD_LOGICAL); ++sq) {
+                count += is_valid_square(sq) && board.squares[sq] != PIECE_NONE;
+            }
+            counted &= (count == num_pieces);
+
+            side_t waiting = OPPOSITE_SIDE(board.side_to_move);
+            legal &= !is_square_attacked(&board, board.king_square[waiting], board.side_to_move);
+
+            char fen[FEN_MAX_LEN];
+            board_get_fen(&board, fen, sizeof(fen));
+            round_trip &= board_set_fen(&parsed, fen) && parsed.key == board.key &&
+                          board.key == zobrist_compute_key(&board);
+        }
+        ASSERT(POSITION_GEN_TESTS, counted);
+        ASSERT(POSITION_GEN_TESTS, legal);
+        ASSERT(POSITION_GEN_TESTS, round_trip);
+    }
+    END_TEST_CASE(POSITION_GEN_TESTS);
+
+    TEST_CASE(POSITION_GEN_TESTS, "No triple checks") {
+        board_t board;
+        board_init(&board);
+
+        /* Crowded placements regularly hold triple checks when left unfiltered */
+        uint32_t seed = 4242;
+        uint8_t most_checkers = 0;
+        for (uint16_t n = 0; n < 2000; ++n) {
+            position_gen_random(&board, &seed, 24 + n % 9);
+            uint8_t checkers = board.check_info.num_checkers;
+            if (checkers > most_checkers) {
+                most_checkers = checkers;
+            }
+        }
+        ASSERT(POSITION_GEN_TESTS, most_checkers == 2);
+    }
+    END_TEST_CASE(POSITION_GEN_TESTS);
+
+    TEST_CASE(POSITION_GEN_TESTS, "Reproducible from the seed") {
+        board_t board;
+        board_init(&board);
+
+        char first[FEN_MAX_LEN];
+        char second[FEN_MAX_LEN];
+        uint32_t seed = 777;
+        position_gen_random(&board, &seed, 20);
+        board_get_fen(&board, first, sizeof(first));
+        seed = 777;
+        position_gen_random(&board, &seed, 20);
+        board_get_fen(&board, second, sizeof(second));
+        ASSERT(POSITION_GEN_TESTS, strcmp(first, second) == 0);
+    }
+    END_TEST_CASE(POSITION_GEN_TESTS);
+
+    TEST_CASE(POSITION_GEN_TESTS, "Corpus emits only written FENs") {
+        corpus_stats_t stats;
+        memset(&stats, 0, sizeof(stats));
+        position_gen_corpus(99, 62, POSITION_GEN_MIN_PIECES, POSITION_GEN_MAX_PIECES, count_fen,
+                            &stats);
+        ASSERT(POSITION_GEN_TESTS, stats.emitted == 62);
+        ASSERT(POSITION_GEN_TESTS, stats.empty == 0);
+        ASSERT(POSITION_GEN_TESTS, levels_match(&stats, 2, 32, 2));
+    }
+    END_TEST_CASE(POSITION_GEN_TESTS);
+
+    TEST_CASE(POSITION_GEN_TESTS, "Corpus piece ranges") {
+        corpus_stats_t stats;
+
+        /* Out-of-range bounds are clamped before levels are cycled */
+        memset(&stats, 0, sizeof(stats));
+        position_gen_corpus(5, 31, 0, 255, count_fen, &stats);
+        ASSERT(POSITION_GEN_TESTS, stats.emitted == 31);
+        ASSERT(POSITION_GEN_TESTS, levels_match(&stats, 2, 32, 1));
+
+        /* Reversed bounds are swapped */
+        memset(&stats, 0, sizeof(stats));
+        position_gen_corpus(5, 22, 20, 10, count_fen, &stats);
+        ASSERT(POSITION_GEN_TESTS, stats.emitted == 22);
+        ASSERT(POSITION_GEN_TESTS, levels_match(&stats, 10, 20, 2));
+    }
+    END_TEST_CASE(POSITION_GEN_TESTS);
+
+    print_test_results(&POSITION_GEN_TESTS);
+}
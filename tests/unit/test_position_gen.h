@@ -0,0 +1,36 @@
+/**
+ * @file test_position_gen.h
+ * @brief Unit tests for the random position generator
+ *
+ * Provides test suites to verify that generated positions are legal, carry
+ * the requested material, round-trip through FEN and are reproducible from
+ * their seed.
+ */
+
+#pragma once
+
+#include "test_framework.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Test suite for the random position generator */
+extern TestSuite POSITION_GEN_TESTS;
+
+/**
+ * @brief Execute all position generator unit tests
+ *
+ * Runs tests covering:
+ *
+ * - Piece counts, legality and FEN round trips of seeded positions
+ * - Rejection of triple checks
+ * - Reproducibility from the seed
+ * - Corpora never emitting an empty FEN
+ * - Corpus piece ranges that are reversed or out of bounds
+ */
+void run_position_gen_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,213 @@
+#include "test_zobrist.h"
+
+#include "board.h"
+#include "fen.h"
+#include "zobrist.h"
+
+#include <string.h>
+
+INIT_TEST_SUITE(ZOBRIST_TESTS);
+
+/**
+ * @brief Get the number of key bits the piece keys really span
+ * @return uint8_t Rank of the piece keys as vectors over GF(2)
+ *
+ * Position keys are XORs of these values, so a rank below ZOBRIST_KEY_BITS
+ * means the keys behave like narrower ones and collide accordingly.
+ */
+static uint8_t piece_key_rank(void) {
+    uint64_t basis[64] = {0};
+    uint8_t rank = 0;
+
+    for (uint8_t kind = 0; kind < ZOBRIST_PIECE_KINDS; ++kind) {
+        for (uint8_t square = 0; square < ZOBRIST_SQUARES; ++square) {
+            uint64_t key = zobrist_piece_keys[kind][square];
+            for (int8_t bit = 63; bit >= 0 && key; --bit) {
+                if (!(key >> bit & 1)) {
+                    continue;
+                }
+                if (!basis[bit]) {
+                    basis[bit] = key;
+                    ++rank;
+                    break;
+                }
+                key ^= basis[bit];
+            }
+        }
+    }
+
+    return rank;
+}
+
+void run_zobrist_tests(void) {
+    TEST_SUITE(ZOBRIST_TESTS);
+
+    TEST_CASE(ZOBRIST_TESTS, "Key width") {
+        bool fits = true;
+        bool nonzero = true;
+        for (uint8_t kind = 0; kind < ZOBRIST_PIECE_KINDS; ++kind) {
+            for (uint8_t square = 0; square < ZOBRIST_SQUARES; ++square) {
+                zobrist_key_t key = zobrist_piece_keys[kind][square];
+                fits &= ((uint64_t)key & ~(uint64_t)ZOBRIST_KEY_MASK) == 0;
+                nonzero &= key != 0;
+            }
+        }
+        ASSERT(ZOBRIST_TESTS, fits);
+        ASSERT(ZOBRIST_TESTS, nonzero);
+        ASSERT(ZOBRIST_TESTS, zobrist_castling_keys[CASTLE_NONE] == 0);
+        ASSERT(ZOBRIST_TESTS, zobrist_castling_keys[CASTLE_ALL] ==
+                                  (zobrist_castling_keys[CASTLE_WK | CASTLE_WQ] ^
+                                   zobrist_castling_keys[CASTLE_BK | CASTLE_BQ]));
+
+        /* Every key bit is independent, not just present */
+        ASSERT(ZOBRIST_TESTS, piece_key_rank() == ZOBRIST_KEY_BITS);
+    }
+    END_TEST_CASE(ZOBRIST_TESTS);
+
+    TEST_CASE(ZOBRIST_TESTS, "Keys from FEN") {
+        board_t board;
+        board_init(&board);
+        ASSERT(ZOBRIST_TESTS, board.key == zobrist_compute_key(&board));
+
+        board_reset(&board);
+        ASSERT(ZOBRIST_TESTS, board.key != 0);
+        ASSERT(ZOBRIST_TESTS, board.key == zobrist_compute_key(&board));
+
+        board_set_fen(&board,
+                      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+        ASSERT(ZOBRIST_TESTS, board.key == zobrist_compute_key(&board));
+
+        board_set_fen(&board, "rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 3");
+        ASSERT(ZOBRIST_TESTS, board.key == zobrist_compute_key(&board));
+    }
+    END_TEST_CASE(ZOBRIST_TESTS);
+
+    TEST_CASE(ZOBRIST_TESTS, "Incremental updates") {
+        board_t board;
+        board_init(&board);
+        board_reset(&board);
+        zobrist_key_t initial = board.key;
+
+        /* Nf3 and back restores the original key */
+        square_t g1 = square_from_file_rank(6, 0);
+        square_t f3 = square_from_file_rank(5, 2);
+        piece_t knight = board_get_piece(&board, g1);
+        board_set_piece(&board, g1, PIECE_NONE);
+        board_set_piece(&board, f3, knight);
+        ASSERT(ZOBRIST_TESTS, board.key != initial);
+        ASSERT(ZOBRIST_TESTS, board.key == zobrist_compute_key(&board));
+
+        board_set_piece(&board, f3, PIECE_NONE);
+        board_set_piece(&board, g1, knight);
+        ASSERT(ZOBRIST_TESTS, board.key == initial);
+
+        /* Replacing a piece in place swaps its contribution */
+        square_t d1 = square_from_file_rank(3, 0);
+        board_set_piece(&board, d1, MAKE_PIECE(PIECE_BLACK, PIECE_QUEEN));
+        ASSERT(ZOBRIST_TESTS, board.key == zobrist_compute_key(&board));
+    }
+    END_TEST_CASE(ZOBRIST_TESTS);
+
+    TEST_CASE(ZOBRIST_TESTS, "Transpositions") {
+        board_t a;
+        board_t b;
+        board_init(&a);
+        board_init(&b);
+
+        /* 1. Nf3 Nf6 2. Nc3 and 1. Nc3 Nf6 2. Nf3 reach the same position */
+        board_set_fen(&a, "rnbqkb1r/pppppppp/5n2/8/8/2N2N2/PPPPPPPP/R1BQKB1R b KQkq - 3 2");
+        board_set_fen(&b, "rnbqkb1r/pppppppp/5n2/8/8/2N2N2/PPPPPPPP/R1BQKB1R b KQkq - 3 2");
+        ASSERT(ZOBRIST_TESTS, a.key == b.key);
+
+        /* Pieces placed in a different order hash the same */
+        board_clear(&a);
+        board_clear(&b);
+        square_t e1 = square_from_file_rank(4, 0);
+        square_t e8 = square_from_file_rank(4, 7);
+        square_t a2 = square_from_file_rank(0, 1);
+        board_set_piece(&a, e1, MAKE_PIECE(PIECE_WHITE, PIECE_KING));
+        board_set_piece(&a, e8, MAKE_PIECE(PIECE_BLACK, PIECE_KING));
+        board_set_piece(&a, a2, MAKE_PIECE(PIECE_WHITE, PIECE_PAWN));
+        board_set_piece(&b, a2, MAKE_PIECE(PIECE_WHITE, PIECE_PAWN));
+        board_set_piece(&b, e8, MAKE_PIECE(PIECE_BLACK, PIECE_KING));
+        board_set_piece(&b, e1, MAKE_PIECE(PIECE_WHITE, PIECE_KING));
+        ASSERT(ZOBRIST_TESTS, a.key == b.key);
+    }
+    END_TEST_CASE(ZOBRIST_TESTS);
+
+    TEST_CASE(ZOBRIST_TESTS, "Side, castling and en passant") {
+        board_t board;
+        board_init(&board);
+
+        board_set_fen(&board, "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1");
+        zobrist_key_t base = board.key;
+
+        board_set_fen(&board, "r3k2r/8/8/8/8/8/8/R3K2R b KQkq - 0 1");
+        ASSERT(ZOBRIST_TESTS, board.key == (base ^ zobrist_side_key));
+
+        board_set_fen(&board, "r3k2r/8/8/8/8/8/8/R3K2R w Kkq - 0 1");
+        ASSERT(ZOBRIST_TESTS, board.key != base);
+        ASSERT(ZOBRIST_TESTS, board.key == zobrist_compute_key(&board));
+
+        /* Move counters are not part of the key */
+        board_set_fen(&board, "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 12 40");
+        ASSERT(ZOBRIST_TESTS, board.key == base);
+
+        board_set_fen(&board, "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1");
+        zobrist_key_t with_ep = board.key;
+        board_set_fen(&board, "4k3/8/8/3pP3/8/8/8/4K3 w - - 0 1");
+        ASSERT(ZOBRIST_TESTS, with_ep == (board.key ^ zobrist_en_passant_keys[3]));
+    }
+    END_TEST_CASE(ZOBRIST_TESTS);
+
+    TEST_CASE(ZOBRIST_TESTS, "Keys straight from FEN text") {
+        static const char* const FENS[] = {
+            INITIAL_FEN,
+            "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+            "rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 3",
+            "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 b - - 12 40",
+        };
+
+        board_t board;
+        board_init(&board);
+        zobrist_key_t key;
+        bool match = true;
+        for (uint8_t i = 0; i < sizeof(FENS) / sizeof(FENS[0]); ++i) {
+            board_set_fen(&board, FENS[i]);
+            match &= fen_to_key(FENS[i], strlen(FENS[i]), &key) && key == board.key;
+        }
+        ASSERT(ZOBRIST_TESTS, match);
+
+        /* Move counters and EPD operations are not read */
+        board_set_fen(&board, INITIAL_FEN);
+        const char* epd = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - bm e4;";
+        ASSERT(ZOBRIST_TESTS, fen_to_key(epd, strlen(epd), &key) && key == board.key);
+        key = 0;
+        ASSERT(ZOBRIST_TESTS, fen_to_key(INITIAL_FEN, strlen(INITIAL_FEN) - 4, &key));
+        ASSERT(ZOBRIST_TESTS, key == board.key);
+
+        /* Malformed fields, trailing junk and truncated input are rejected */
+        static const char* const BAD_FENS[] = {
+            "rnbqkbnr/ppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1",
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQxq - 0 1",
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq z9 0 1",
+            "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3junk 0 1",
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq -garbage",
+        };
+        bool rejected = true;
+        for (uint8_t i = 0; i < sizeof(BAD_FENS) / sizeof(BAD_FENS[0]); ++i) {
+            key = 1;
+            rejected &= !fen_to_key(BAD_FENS[i], strlen(BAD_FENS[i]), &key) && key == 1;
+            rejected &= !board_set_fen(&board, BAD_FENS[i]);
+        }
+        ASSERT(ZOBRIST_TESTS, rejected);
+        ASSERT(ZOBRIST_TESTS, !fen_to_key(INITIAL_FEN, 46, &key));
+        ASSERT(ZOBRIST_TESTS, !fen_to_key(INITIAL_FEN, 0, &key));
+        ASSERT(ZOBRIST_TESTS, !fen_to_key(NULL, 10, &key));
+        ASSERT(ZOBRIST_TESTS, !fen_to_key(INITIAL_FEN, strlen(INITIAL_FEN), NULL));
+    }
+    END_TEST_CASE(ZOBRIST_TESTS);
+
+    print_test_results(&ZOBRIST_TESTS);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file test_zobrist.h
+ * @brief Unit tests for Zobrist position keys
+ *
+ * Provides test suites to verify that incrementally maintained keys always
+ * match a full recomputation and that keys separate positions that differ
+ * only in side to move, castling rights or en passant file.
+ */
+
+#pragma once
+
+#include "test_framework.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Test suite for Zobrist position keys */
+extern TestSuite ZOBRIST_TESTS;
+
+/**
+ * @brief Execute all Zobrist-related unit tests
+ *
+ * Runs tests covering:
+ *
+ * - Key tables respecting and spanning the configured key width
+ * - Keys set up by board_set_fen() matching a full recomputation
+ * - Incremental updates through board_set_piece()
+ * - Transpositions reaching the same key
+ * - Side to move, castling and en passant changing the key
+ * - Keys computed directly from FEN text by fen_to_key()
+ */
+void run_zobrist_tests(void);
+
+#ifdef __cplusplus
+}
+#endif
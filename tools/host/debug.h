@@ -0,0 +1,13 @@
+/**
+ * @file debug.h
+ * @brief Host stand-in for the CE toolchain's debug console
+ *
+ * Lets engine sources that log through dbg_printf() build into host tools.
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+#define dbg_printf         printf
+#define dbg_ClearConsole() ((void)0)
@@ -0,0 +1,191 @@
+/**
+ * @file zobrist_collisions.c
+ * @brief Host tool measuring Zobrist key collisions at every key width
+ *
+ * Hashes a seeded corpus of random legal positions and counts pairs of
+ * different positions that share a key, at 24, 32, 48 and 64 bits. Every
+ * position is kept packed next to its key, so a shared key is only counted
+ * as a collision after the positions themselves are compared.
+ *
+ * zobrist_init() draws the same 64-bit values at every width and masks them,
+ * so the low bits of a 64-bit key are exactly the key a narrower build
+ * computes. One 64-bit build therefore measures all widths. Build and run
+ * on the host with:
+ *
+ *     cc -O2 -DZOBRIST_KEY_BITS=64 -Duint24_t=uint32_t -Duint48_t=uint64_t \
+ *        -include stdint.h -include stddef.h -Isrc -Itools/host \
+ *        tools/zobrist_collisions.c src/attack.c src/board.c src/fen.c \
+ *        src/position_gen.c src/zobrist.c -lm -o zobrist_collisions
+ *     ./zobrist_collisions [positions] [seed]
+ */
+
+#include "board.h"
+#include "position_gen.h"
+#include "zobrist.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if ZOBRIST_KEY_BITS != 64
+#error "Build with -DZOBRIST_KEY_BITS=64; narrower widths are measured by masking"
+#endif
+
+/** Positions hashed when no count is given */
+#define DEFAULT_POSITIONS (1UL << 20)
+
+/** Corpus seed used when none is given */
+#define DEFAULT_SEED 0x5EED1234UL
+
+/** Bytes of a packed position: 64 four-bit squares, then side, castling and en passant */
+#define PACKED_SIZE (ZOBRIST_SQUARES / 2 + 3)
+
+/**
+ * @brief One hashed position
+ */
+typedef struct {
+    uint64_t key;                /**< Full 64-bit key */
+    uint8_t packed[PACKED_SIZE]; /**< Position the key was computed from */
+} entry_t;
+
+/** Key bits compared by compare_entries() */
+static uint64_t compare_mask;
+
+// ==========================
+//    Helper Functions
+// ==========================
+
+/**
+ * @brief Pack everything a key depends on into a fixed-size record
+ * @param board  Position to pack
+ * @param packed Receives PACKED_SIZE bytes
+ */
+static void pack_position(const board_t* board, uint8_t* packed) {
+    memset(packed, 0, PACKED_SIZE);
+
+    for (uint8_t index = 0; index < ZOBRIST_SQUARES; ++index) {
+        piece_t piece = board->squares[square_from_file_rank(index & 7, index >> 3)];
+        uint8_t code = 0;
+        if (piece != PIECE_NONE) {
+            code = GET_PIECE_TYPE(piece) + (IS_PIECE_COLOR(piece, PIECE_BLACK) ? 6 : 0);
+        }
+        packed[index >> 1] |= code << ((index & 1) * 4);
+    }
+
+    packed[ZOBRIST_SQUARES / 2] = board->side_to_move;
+    packed[ZOBRIST_SQUARES / 2 + 1] = board->castling_rights;
+    packed[ZOBRIST_SQUARES / 2 + 2] = board->en_passant_square;
+}
+
+/**
+ * @brief Order entries by masked key, then by position
+ * @param a First entry
+ * @param b Second entry
+ * @return int qsort() ordering
+ */
+static int compare_entries(const void* a, const void* b) {
+    const entry_t* x = a;
+    const entry_t* y = b;
+    uint64_t kx = x->key & compare_mask;
+    uint64_t ky = y->key & compare_mask;
+
+    if (kx != ky) {
+        return kx < ky ? -1 : 1;
+    }
+    return memcmp(x->packed, y->packed, PACKED_SIZE);
+}
+
+/**
+ * @brief Count collisions among entries at one key width
+ * @param entries    Entries to sort in place
+ * @param count      Number of entries
+ * @param bits       Key width to measure
+ * @param duplicates Receives the number of repeated positions
+ * @return unsigned long Distinct positions that share a key with an earlier one
+ */
+static unsigned long count_collisions(entry_t* entries, size_t count, uint8_t bits,
+                                      unsigned long* duplicates) {
+    compare_mask = (bits == 64) ? ~(uint64_t)0 : ((uint64_t)1 << bits) - 1;
+    qsort(entries, count, sizeof(entry_t), compare_entries);
+
+    unsigned long collisions = 0;
+    *duplicates = 0;
+    for (size_t i = 1; i < count; ++i) {
+        if (((entries[i].key ^ entries[i - 1].key) & compare_mask) != 0) {
+            continue;
+        }
+
+        /* Sorted by position within a key, so repeats are adjacent */
+        if (memcmp(entries[i].packed, entries[i - 1].packed, PACKED_SIZE) == 0) {
+            ++*duplicates;
+        } else {
+            ++collisions;
+        }
+    }
+
+    return collisions;
+}
+
+// ==========================
+//       Entry Point
+// ==========================
+
+int main(int argc, char** argv) {
+    static const uint8_t WIDTHS[] = {24, 32, 48, 64};
+
+    size_t count = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_POSITIONS;
+    uint32_t corpus_seed = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 0) : DEFAULT_SEED;
+    if (count < 2 || corpus_seed == 0) {
+        fprintf(stderr, "usage: %s [positions >= 2] [seed != 0]\n", argv[0]);
+        return 2;
+    }
+
+    entry_t* entries = malloc(count * sizeof(entry_t));
+    if (!entries) {
+        fprintf(stderr, "out of memory for %zu positions\n", count);
+        return 2;
+    }
+
+    zobrist_init();
+
+    /* Cycle piece counts so every game phase is equally represented */
+    board_t board;
+    board_init(&board);
+    uint32_t seed = corpus_seed;
+    uint8_t span = POSITION_GEN_MAX_PIECES - POSITION_GEN_MIN_PIECES + 1;
+    for (size_t i = 0; i < count; ++i) {
+        position_gen_random(&board, &seed, POSITION_GEN_MIN_PIECES + i % span);
+        if (board.key != zobrist_compute_key(&board)) {
+            fprintf(stderr, "incremental key mismatch at position %zu\n", i);
+            free(entries);
+            return 1;
+        }
+        entries[i].key = board.key;
+        pack_position(&board, entries[i].packed);
+    }
+
+    printf("%zu positions, seed 0x%08lX\n\n", count, (unsigned long)corpus_seed);
+    printf("%5s %10s %12s %14s %14s\n", "bits", "distinct", "collisions", "rate", "expected");
+
+    unsigned long full_collisions = 0;
+    for (uint8_t i = 0; i < sizeof(WIDTHS) / sizeof(WIDTHS[0]); ++i) {
+        unsigned long duplicates;
+        unsigned long collisions = count_collisions(entries, count, WIDTHS[i], &duplicates);
+        double distinct = (double)(count - duplicates);
+
+        /* Birthday bound: n distinct positions spread over 2^bits keys */
+        double expected = ldexp(distinct * (distinct - 1) / 2, -WIDTHS[i]);
+        printf("%5u %10.0f %12lu %14.3e %14.3e\n", WIDTHS[i], distinct, collisions,
+               collisions / distinct, expected);
+
+        if (WIDTHS[i] == 64) {
+            full_collisions = collisions;
+        }
+    }
+
+    free(entries);
+
+    /* A 64-bit collision in a corpus this small points at a broken key */
+    return full_collisions ? 1 : 0;
+}